@@ -56,10 +56,12 @@
 #include <libhyputil/CommonData.h>
 #include <libhyputil/CommonIO.h>
 #include <libhyputil/JSON.h>
+#include <libhyputil/StringUtils.h>
 
 #include <algorithm>
 #include <fstream>
 #include <memory>
+#include <sstream>
 
 #include <range/v3/view/map.hpp>
 
@@ -610,6 +612,7 @@ void CommandLineInterface::readInputFiles()
 
 	if (
 		m_options.input.mode != InputMode::LanguageServer &&
+		m_options.input.mode != InputMode::StandardJsonServer &&
 		m_fileReader.sourceUnits().empty() &&
 		!m_standardJsonInput.has_value()
 	)
@@ -749,6 +752,9 @@ void CommandLineInterface::processInput()
 		m_standardJsonInput.reset();
 		break;
 	}
+	case InputMode::StandardJsonServer:
+		serveStandardJson();
+		break;
 	case InputMode::LanguageServer:
 		serveLSP();
 		break;
@@ -1030,11 +1036,14 @@ void CommandLineInterface::handleCombinedJSON()
 		}
 	}
 
-	std::string json = jsonPrint(removeNullMembers(std::move(output)), m_options.formatting.json);
+	output = removeNullMembers(std::move(output));
 	if (!m_options.output.dir.empty())
-		createJson("combined", json);
+		createJson("combined", jsonPrint(output, m_options.formatting.json));
 	else
-		sout() << json << std::endl;
+	{
+		jsonPrint(sout(), output, m_options.formatting.json);
+		sout() << std::endl;
+	}
 }
 
 void CommandLineInterface::handleAst()
@@ -1071,6 +1080,42 @@ void CommandLineInterface::handleAst()
 	}
 }
 
+void CommandLineInterface::serveStandardJson()
+{
+	hypAssert(m_options.input.mode == InputMode::StandardJsonServer);
+	hypAssert(!m_standardJsonInput.has_value());
+
+	// Optimized Yul objects are reused by later requests that contain them unchanged.
+	auto optimizedCodeCache = std::make_shared<yul::PersistentOptimizedCodeCache>();
+
+	std::string header;
+	while (std::getline(m_sin, header))
+	{
+		if (!header.empty() && header.back() == '\r')
+			header.pop_back();
+
+		std::optional<size_t> length;
+		if (!header.empty() && header.size() <= 18 && std::all_of(header.begin(), header.end(), isDigit))
+			length = static_cast<size_t>(std::stoull(header));
+		if (!length.has_value())
+			hypThrow(CommandLineExecutionError, "Invalid Standard JSON request header: \"" + header + "\".");
+
+		std::string input(*length, '\0');
+		if (!m_sin.read(input.data(), static_cast<std::streamsize>(*length)))
+			hypThrow(CommandLineExecutionError, "Unexpected end of input while reading a Standard JSON request.");
+
+		// Files loaded by the import callback of the previous request must not leak into this one.
+		// Everything that does not depend on the request (e.g. the optimiser step tables) stays warm.
+		m_fileReader.setSourceUnits({});
+
+		StandardCompiler compiler(m_universalCallback.callback(), m_options.formatting.json);
+		compiler.setPersistentOptimizedCodeCache(optimizedCodeCache);
+		std::string response = compiler.compile(input);
+		response += '\n';
+		sout() << response.size() << '\n' << response << std::flush;
+	}
+}
+
 void CommandLineInterface::serveLSP()
 {
 	lsp::StdioTransport transport;
@@ -1082,34 +1127,40 @@ void CommandLineInterface::link()
 {
 	hypAssert(m_options.input.mode == InputMode::Linker);
 
-	// Map from how the libraries will be named inside the bytecode to their addresses.
-	std::map<std::string, h512> librariesReplacements;
+	// Map from how the libraries will be named inside the bytecode to the hex representation
+	// of their addresses. It is built once and shared by all linked files.
+	std::map<std::string, std::string> librariesReplacements;
+	// Hints for the libraries we link, which are removed from the linked files.
+	std::set<std::string, std::less<>> resolvedLibraryHints;
 	int const placeholderSize = 2 * AddressBytes; // AddressBytes encoded as hex characters
 	for (auto const& library: m_options.linker.libraries)
 	{
 		std::string const& name = library.first;
+		std::string addressHex = util::toHex(library.second.asBytes());
 		// Library placeholders are AddressBytes hex digits that start and end with '__'.
 		// This leaves placeholderSize - 4 characters for the library identifier. The identifier used to
 		// be just the cropped or '_'-padded library name, but this changed to
 		// the cropped hex representation of the hash of the library name.
 		// We support both ways of linking here.
-		librariesReplacements["__" + qrvmasm::LinkerObject::libraryPlaceholder(name) + "__"] = library.second;
+		librariesReplacements["__" + qrvmasm::LinkerObject::libraryPlaceholder(name) + "__"] = addressHex;
 
 		std::string replacement = "__";
 		for (size_t i = 0; i < placeholderSize - 4; ++i)
 			replacement.push_back(i < name.size() ? name[i] : '_');
 		replacement += "__";
-		librariesReplacements[replacement] = library.second;
+		librariesReplacements[replacement] = addressHex;
+
+		resolvedLibraryHints.insert(libraryPlaceholderHint(name));
 	}
 
 	FileReader::StringMap sourceCodes = m_fileReader.sourceUnits();
 	for (auto& src: sourceCodes)
 	{
+		// Distinct unresolved placeholders in the order of their first occurrence.
+		std::vector<std::string> unresolvedReferences;
 		auto end = src.second.end();
-		for (auto it = src.second.begin(); it != end;)
+		for (auto it = std::find(src.second.begin(), end, '_'); it != end; it = std::find(it, end, '_'))
 		{
-			while (it != end && *it != '_') ++it;
-			if (it == end) break;
 			if (
 				end - it < placeholderSize ||
 				*(it + 1) != '_' ||
@@ -1123,23 +1174,41 @@ void CommandLineInterface::link()
 				);
 
 			std::string foundPlaceholder(it, it + placeholderSize);
-			if (librariesReplacements.count(foundPlaceholder))
+			if (auto replacement = librariesReplacements.find(foundPlaceholder); replacement != librariesReplacements.end())
+				copy(replacement->second.begin(), replacement->second.end(), it);
+			else if (!util::contains(unresolvedReferences, foundPlaceholder))
+				unresolvedReferences.emplace_back(std::move(foundPlaceholder));
+			it += placeholderSize;
+		}
+		for (std::string const& reference: unresolvedReferences)
+			report(
+				Error::Severity::Warning,
+				fmt::format("Reference \"{}\" in file \"{}\" still unresolved.", reference, src.first)
+			);
+
+		// Remove hints for resolved libraries. Hints occupy whole lines after the bytecode,
+		// which may also end in "\r\n".
+		std::string linked;
+		linked.reserve(src.second.size());
+		for (size_t lineStart = 0; lineStart <= src.second.size();)
+		{
+			size_t lineEnd = std::min(src.second.find('\n', lineStart), src.second.size());
+			std::string_view line(src.second.data() + lineStart, lineEnd - lineStart);
+			std::string_view hint = line;
+			if (!hint.empty() && hint.back() == '\r')
+				hint.remove_suffix(1);
+			if (lineStart == 0)
+				linked += line;
+			else if (!resolvedLibraryHints.count(hint))
 			{
-				std::string hexStr(util::toHex(librariesReplacements.at(foundPlaceholder).asBytes()));
-				copy(hexStr.begin(), hexStr.end(), it);
+				linked += '\n';
+				linked += line;
 			}
-			else
-				report(
-					Error::Severity::Warning,
-					fmt::format("Reference \"{}\" in file \"{}\" still unresolved.", foundPlaceholder, src.first)
-				);
-			it += placeholderSize;
+			lineStart = lineEnd + 1;
 		}
-		// Remove hints for resolved libraries.
-		for (auto const& library: m_options.linker.libraries)
-			boost::algorithm::erase_all(src.second, "\n" + libraryPlaceholderHint(library.first));
-		while (!src.second.empty() && *prev(src.second.end()) == '\n')
-			src.second.resize(src.second.size() - 1);
+		while (!linked.empty() && (linked.back() == '\n' || linked.back() == '\r'))
+			linked.pop_back();
+		src.second = std::move(linked);
 	}
 	m_fileReader.setSourceUnits(std::move(sourceCodes));
 }
@@ -87,6 +87,9 @@ private:
 	void printLicense();
 	void compile();
 	void assembleFromQRVMAssemblyJSON();
+	/// Compiles length-prefixed Standard JSON requests read from standard input until it is exhausted,
+	/// writing each result with the same framing.
+	void serveStandardJson();
 	void serveLSP();
 	void link();
 	void writeLinkedFiles();
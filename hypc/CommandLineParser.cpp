@@ -86,6 +86,7 @@ static std::string const g_strOptimize = "optimize";
 static std::string const g_strOptimizeRuns = "optimize-runs";
 static std::string const g_strOptimizeYul = "optimize-yul";
 static std::string const g_strYulOptimizations = "yul-optimizations";
+static std::string const g_strYulMinRoundGain = "yul-min-round-gain";
 static std::string const g_strOutputDir = "output-dir";
 static std::string const g_strOverwrite = "overwrite";
 static std::string const g_strRevertStrings = "revert-strings";
@@ -104,6 +105,7 @@ static std::set<std::string> const g_revertStringsArgs
 static std::string const g_strSources = "sources";
 static std::string const g_strSourceList = "sourceList";
 static std::string const g_strStandardJSON = "standard-json";
+static std::string const g_strStandardJSONServer = "standard-json-server";
 static std::string const g_strStrictAssembly = "strict-assembly";
 static std::string const g_strSwarm = "swarm";
 static std::string const g_strPrettyJson = "pretty-json";
@@ -142,6 +144,7 @@ static std::map<InputMode, std::string> const g_inputModeName = {
 	{InputMode::CompilerWithASTImport, "compiler (AST import)"},
 	{InputMode::Assembler, "assembler"},
 	{InputMode::StandardJson, "standard JSON"},
+	{InputMode::StandardJsonServer, "standard JSON server"},
 	{InputMode::Linker, "linker"},
 	{InputMode::LanguageServer, "language server (LSP)"},
 	{InputMode::QRVMAssemblerJSON, "QRVM assembler (JSON format)"},
@@ -254,6 +257,7 @@ bool CommandLineOptions::operator==(CommandLineOptions const& _other) const noex
 		optimizer.optimizeYul == _other.optimizer.optimizeYul &&
 		optimizer.expectedExecutionsPerDeployment == _other.optimizer.expectedExecutionsPerDeployment &&
 		optimizer.yulSteps == _other.optimizer.yulSteps &&
+		optimizer.yulMinRoundGain == _other.optimizer.yulMinRoundGain &&
 		modelChecker.initialize == _other.modelChecker.initialize &&
 		modelChecker.settings == _other.modelChecker.settings;
 }
@@ -288,6 +292,9 @@ OptimiserSettings CommandLineOptions::optimiserSettings() const
 			hypAssert(settings.yulOptimiserCleanupSteps == OptimiserSettings::DefaultYulOptimiserCleanupSteps);
 	}
 
+	if (optimizer.yulMinRoundGain.has_value())
+		settings.yulOptimiserMinRoundGain = optimizer.yulMinRoundGain.value();
+
 	return settings;
 }
 
@@ -310,7 +317,7 @@ void CommandLineParser::parseInputPathsAndRemappings()
 				if (!remapping.has_value())
 					hypThrow(CommandLineValidationError, "Invalid remapping: \"" + positionalArg + "\".");
 
-				if (m_options.input.mode == InputMode::StandardJson)
+				if (m_options.input.mode == InputMode::StandardJson || m_options.input.mode == InputMode::StandardJsonServer)
 					hypThrow(
 						CommandLineValidationError,
 						"Import remappings are not accepted on the command line in Standard JSON mode.\n"
@@ -350,6 +357,15 @@ void CommandLineParser::parseInputPathsAndRemappings()
 			// Keep it working that way for backwards-compatibility.
 			m_options.input.addStdin = true;
 	}
+	else if (m_options.input.mode == InputMode::StandardJsonServer)
+	{
+		if (!m_options.input.paths.empty() || m_options.input.addStdin)
+			hypThrow(
+				CommandLineValidationError,
+				"Input files are not accepted in --" + g_strStandardJSONServer + " mode.\n"
+				"Requests are read from standard input."
+			);
+	}
 	else if (m_options.input.paths.size() == 0 && !m_options.input.addStdin)
 		hypThrow(
 			CommandLineValidationError,
@@ -493,6 +509,7 @@ void CommandLineParser::parseOutputSelection()
 		case InputMode::Assembler:
 			return util::contains(assemblerModeOutputs, _outputName);
 		case InputMode::StandardJson:
+		case InputMode::StandardJsonServer:
 		case InputMode::Linker:
 			return false;
 		}
@@ -641,6 +658,12 @@ General Information)").c_str(),
 			"Switch to Standard JSON input / output mode, ignoring all options. "
 			"It reads from standard input, if no input file was given, otherwise it reads from the provided input file. The result will be written to standard output."
 		)
+		(
+			g_strStandardJSONServer.c_str(),
+			("Switch to Standard JSON server mode. Keeps the compiler running and reads a sequence of "
+			"Standard JSON requests from standard input, each one preceded by a line holding its length in bytes. "
+			"Each result is written to standard output in the same way, with the same content as in --" + g_strStandardJSON + " mode.").c_str()
+		)
 		(
 			g_strLink.c_str(),
 			("Switch to linker mode, ignoring all options apart from --" + g_strLibraries + " "
@@ -811,6 +834,12 @@ General Information)").c_str(),
 			po::value<std::string>()->value_name("steps"),
 			"Forces Yul optimizer to use the specified sequence of optimization steps instead of the built-in one."
 		)
+		(
+			g_strYulMinRoundGain.c_str(),
+			po::value<unsigned>()->value_name("percent"),
+			"Stop repeating a bracketed part of the Yul optimizer sequence once a round reduces the code size "
+			"by less than the given percentage. By default it is repeated until the code size no longer changes."
+		)
 	;
 	desc.add(optimizerOptions);
 
@@ -938,6 +967,7 @@ void CommandLineParser::processArgs()
 		g_strLicense,
 		g_strVersion,
 		g_strStandardJSON,
+		g_strStandardJSONServer,
 		g_strLink,
 		g_strAssemble,
 		g_strStrictAssembly,
@@ -955,6 +985,8 @@ void CommandLineParser::processArgs()
 		m_options.input.mode = InputMode::Version;
 	else if (m_args.count(g_strStandardJSON) > 0)
 		m_options.input.mode = InputMode::StandardJson;
+	else if (m_args.count(g_strStandardJSONServer) > 0)
+		m_options.input.mode = InputMode::StandardJsonServer;
 	else if (m_args.count(g_strLSP))
 		m_options.input.mode = InputMode::LanguageServer;
 	else if (m_args.count(g_strAssemble) > 0 || m_args.count(g_strStrictAssembly) > 0 || m_args.count(g_strYul) > 0)
@@ -1066,7 +1098,7 @@ void CommandLineParser::processArgs()
 				"Option --" + g_strOptimizeRuns + " is only valid in compiler and assembler modes."
 			);
 
-		for (std::string const& option: {g_strOptimize, g_strNoOptimizeYul, g_strOptimizeYul, g_strYulOptimizations})
+		for (std::string const& option: {g_strOptimize, g_strNoOptimizeYul, g_strOptimizeYul, g_strYulOptimizations, g_strYulMinRoundGain})
 			if (m_args.count(option) > 0)
 				hypThrow(
 					CommandLineValidationError,
@@ -1171,7 +1203,7 @@ void CommandLineParser::processArgs()
 
 	parseInputPathsAndRemappings();
 
-	if (m_options.input.mode == InputMode::StandardJson)
+	if (m_options.input.mode == InputMode::StandardJson || m_options.input.mode == InputMode::StandardJsonServer)
 		return;
 
 	if (m_args.count(g_strLibraries))
@@ -1225,6 +1257,15 @@ void CommandLineParser::processArgs()
 		m_options.optimizer.yulSteps = m_args[g_strYulOptimizations].as<std::string>();
 	}
 
+	if (m_args.count(g_strYulMinRoundGain))
+	{
+		if (!m_options.optimiserSettings().runYulOptimiser)
+			hypThrow(CommandLineValidationError, "--" + g_strYulMinRoundGain + " is invalid if Yul optimizer is disabled.");
+		if (m_args[g_strYulMinRoundGain].as<unsigned>() > 100)
+			hypThrow(CommandLineValidationError, "--" + g_strYulMinRoundGain + " must be a percentage between 0 and 100.");
+		m_options.optimizer.yulMinRoundGain = m_args[g_strYulMinRoundGain].as<unsigned>();
+	}
+
 	if (m_options.input.mode == InputMode::Assembler)
 	{
 		std::vector<std::string> const nonAssemblyModeOptions = {
@@ -54,6 +54,7 @@ enum class InputMode
 	Compiler,
 	CompilerWithASTImport,
 	StandardJson,
+	StandardJsonServer,
 	Linker,
 	Assembler,
 	LanguageServer,
@@ -227,6 +228,7 @@ struct CommandLineOptions
 		bool optimizeYul = false;
 		std::optional<unsigned> expectedExecutionsPerDeployment;
 		std::optional<std::string> yulSteps;
+		std::optional<unsigned> yulMinRoundGain;
 	} optimizer;
 
 	struct
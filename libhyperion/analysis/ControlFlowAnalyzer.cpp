@@ -20,9 +20,11 @@
 
 #include <liblangutil/SourceLocation.h>
 #include <libhyputil/Algorithms.h>
+#include <libhyputil/Concurrency.h>
 
 #include <range/v3/algorithm/sort.hpp>
 
+#include <exception>
 #include <functional>
 
 using namespace std::placeholders;
@@ -32,35 +34,44 @@ using namespace hyperion::frontend;
 
 bool ControlFlowAnalyzer::run()
 {
+	std::vector<std::pair<CFG::FunctionContractTuple, FunctionFlow const*>> flows;
 	for (auto& [pair, flow]: m_cfg.allFunctionFlows())
-		analyze(*pair.function, pair.contract, *flow);
+		if (pair.function->isImplemented())
+			flows.emplace_back(pair, flow.get());
+
+	std::vector<FlowAnalysis> analyses(flows.size());
+	std::vector<std::exception_ptr> failures(flows.size());
+	util::forEachIndexConcurrently(flows.size(), m_threadCount, [&](size_t _index) {
+		try
+		{
+			analyses[_index] = analyzeFlow(*flows[_index].second);
+		}
+		catch (...)
+		{
+			failures[_index] = std::current_exception();
+		}
+	});
+
+	// Reporting has to stay sequential: it uses annotations and warnings are de-duplicated across flows.
+	for (size_t i = 0; i < flows.size(); ++i)
+	{
+		if (failures[i])
+			std::rethrow_exception(failures[i]);
+		report(*flows[i].first.function, flows[i].first.contract, analyses[i]);
+	}
 
 	return !Error::containsErrors(m_errorReporter.errors());
 }
 
-void ControlFlowAnalyzer::analyze(FunctionDefinition const& _function, ContractDefinition const* _contract, FunctionFlow const& _flow)
+ControlFlowAnalyzer::FlowAnalysis ControlFlowAnalyzer::analyzeFlow(FunctionFlow const& _flow)
 {
-	if (!_function.isImplemented())
-		return;
-
-	std::optional<std::string> mostDerivedContractName;
-
-	// The name of the most derived contract only required if it differs from
-	// the functions contract
-	if (_contract && _contract != _function.annotation().contract)
-		mostDerivedContractName = _contract->name();
-
-	checkUninitializedAccess(
-		_flow.entry,
-		_flow.exit,
-		_function.body().statements().empty(),
-		mostDerivedContractName
-	);
-	checkUnreachable(_flow.entry, _flow.exit, _flow.revert, _flow.transactionReturn);
+	return {
+		findUninitializedAccesses(_flow.entry, _flow.exit),
+		findUnreachable(_flow.entry, _flow.exit, _flow.revert, _flow.transactionReturn)
+	};
 }
 
-
-void ControlFlowAnalyzer::checkUninitializedAccess(CFGNode const* _entry, CFGNode const* _exit, bool _emptyBody, std::optional<std::string> _contractName)
+std::vector<VariableOccurrence const*> ControlFlowAnalyzer::findUninitializedAccesses(CFGNode const* _entry, CFGNode const* _exit)
 {
 	struct NodeInfo
 	{
@@ -135,65 +146,21 @@ void ControlFlowAnalyzer::checkUninitializedAccess(CFGNode const* _entry, CFGNod
 	}
 
 	auto const& exitInfo = nodeInfos[_exit];
-	if (!exitInfo.uninitializedVariableAccesses.empty())
-	{
-		std::vector<VariableOccurrence const*> uninitializedAccessesOrdered(
-			exitInfo.uninitializedVariableAccesses.begin(),
-			exitInfo.uninitializedVariableAccesses.end()
-		);
-		ranges::sort(
-			uninitializedAccessesOrdered,
-			[](VariableOccurrence const* lhs, VariableOccurrence const* rhs) -> bool
-			{
-				return *lhs < *rhs;
-			}
-		);
-
-		for (auto const* variableOccurrence: uninitializedAccessesOrdered)
+	std::vector<VariableOccurrence const*> uninitializedAccessesOrdered(
+		exitInfo.uninitializedVariableAccesses.begin(),
+		exitInfo.uninitializedVariableAccesses.end()
+	);
+	ranges::sort(
+		uninitializedAccessesOrdered,
+		[](VariableOccurrence const* lhs, VariableOccurrence const* rhs) -> bool
 		{
-			VariableDeclaration const& varDecl = variableOccurrence->declaration();
-
-			SecondarySourceLocation ssl;
-			if (variableOccurrence->occurrence())
-				ssl.append("The variable was declared here.", varDecl.location());
-
-			bool isStorage = varDecl.type()->dataStoredIn(DataLocation::Storage);
-			bool isCalldata = varDecl.type()->dataStoredIn(DataLocation::CallData);
-			if (isStorage || isCalldata)
-				m_errorReporter.typeError(
-					3464_error,
-					variableOccurrence->occurrence() ?
-						*variableOccurrence->occurrence() :
-						varDecl.location(),
-					ssl,
-					"This variable is of " +
-					std::string(isStorage ? "storage" : "calldata") +
-					" pointer type and can be " +
-					(variableOccurrence->kind() == VariableOccurrence::Kind::Return ? "returned" : "accessed") +
-					" without prior assignment, which would lead to undefined behaviour."
-				);
-			else if (!_emptyBody && varDecl.name().empty())
-			{
-				if (!m_unassignedReturnVarsAlreadyWarnedFor.emplace(&varDecl).second)
-					continue;
-
-				m_errorReporter.warning(
-					6321_error,
-					varDecl.location(),
-					"Unnamed return variable can remain unassigned" +
-					(
-						_contractName.has_value() ?
-						" when the function is called when \"" + _contractName.value() + "\" is the most derived contract." :
-						"."
-					) +
-					" Add an explicit return with value to all non-reverting code paths or name the variable."
-				);
-			}
+			return *lhs < *rhs;
 		}
-	}
+	);
+	return uninitializedAccessesOrdered;
 }
 
-void ControlFlowAnalyzer::checkUnreachable(CFGNode const* _entry, CFGNode const* _exit, CFGNode const* _revert, CFGNode const* _transactionReturn)
+std::set<SourceLocation> ControlFlowAnalyzer::findUnreachable(CFGNode const* _entry, CFGNode const* _exit, CFGNode const* _revert, CFGNode const* _transactionReturn)
 {
 	// collect all nodes reachable from the entry point
 	std::set<CFGNode const*> reachable = util::BreadthFirstSearch<CFGNode const*>{{_entry}}.run(
@@ -215,11 +182,78 @@ void ControlFlowAnalyzer::checkUnreachable(CFGNode const* _entry, CFGNode const*
 		}
 	);
 
-	for (auto it = unreachable.begin(); it != unreachable.end();)
+	return unreachable;
+}
+
+void ControlFlowAnalyzer::report(FunctionDefinition const& _function, ContractDefinition const* _contract, FlowAnalysis const& _analysis)
+{
+	std::optional<std::string> mostDerivedContractName;
+
+	// The name of the most derived contract only required if it differs from
+	// the functions contract
+	if (_contract && _contract != _function.annotation().contract)
+		mostDerivedContractName = _contract->name();
+
+	reportUninitializedAccesses(
+		_analysis.uninitializedAccesses,
+		_function.body().statements().empty(),
+		mostDerivedContractName
+	);
+	reportUnreachable(_analysis.unreachable);
+}
+
+void ControlFlowAnalyzer::reportUninitializedAccesses(std::vector<VariableOccurrence const*> const& _accesses, bool _emptyBody, std::optional<std::string> _contractName)
+{
+	for (auto const* variableOccurrence: _accesses)
+	{
+		VariableDeclaration const& varDecl = variableOccurrence->declaration();
+
+		SecondarySourceLocation ssl;
+		if (variableOccurrence->occurrence())
+			ssl.append("The variable was declared here.", varDecl.location());
+
+		bool isStorage = varDecl.type()->dataStoredIn(DataLocation::Storage);
+		bool isCalldata = varDecl.type()->dataStoredIn(DataLocation::CallData);
+		if (isStorage || isCalldata)
+			m_errorReporter.typeError(
+				3464_error,
+				variableOccurrence->occurrence() ?
+					*variableOccurrence->occurrence() :
+					varDecl.location(),
+				ssl,
+				"This variable is of " +
+				std::string(isStorage ? "storage" : "calldata") +
+				" pointer type and can be " +
+				(variableOccurrence->kind() == VariableOccurrence::Kind::Return ? "returned" : "accessed") +
+				" without prior assignment, which would lead to undefined behaviour."
+			);
+		else if (!_emptyBody && varDecl.name().empty())
+		{
+			if (!m_unassignedReturnVarsAlreadyWarnedFor.emplace(&varDecl).second)
+				continue;
+
+			m_errorReporter.warning(
+				6321_error,
+				varDecl.location(),
+				"Unnamed return variable can remain unassigned" +
+				(
+					_contractName.has_value() ?
+					" when the function is called when \"" + _contractName.value() + "\" is the most derived contract." :
+					"."
+				) +
+				" Add an explicit return with value to all non-reverting code paths or name the variable."
+			);
+		}
+	}
+}
+
+void ControlFlowAnalyzer::reportUnreachable(std::set<SourceLocation> const& _unreachable)
+{
+	for (auto it = _unreachable.begin(); it != _unreachable.end();)
 	{
 		SourceLocation location = *it++;
 		// Extend the location, as long as the next location overlaps (unreachable is sorted).
-		for (; it != unreachable.end() && it->start <= location.end; ++it)
+		for (; it != _unreachable.end() && it->start <= location.end; ++it)
 			location.end = std::max(location.end, it->end);
 
 		if (m_unreachableLocationsAlreadyWarnedFor.emplace(location).second)
@@ -20,7 +20,10 @@
 
 #include <libhyperion/analysis/ControlFlowGraph.h>
 #include <liblangutil/ErrorReporter.h>
+#include <optional>
 #include <set>
+#include <string>
+#include <vector>
 
 namespace hyperion::frontend
 {
@@ -28,26 +31,46 @@ namespace hyperion::frontend
 class ControlFlowAnalyzer
 {
 public:
-	explicit ControlFlowAnalyzer(CFG const& _cfg, langutil::ErrorReporter& _errorReporter):
-		m_cfg(_cfg), m_errorReporter(_errorReporter) {}
+	/// @param _threadCount the maximum number of threads used, including the calling thread.
+	explicit ControlFlowAnalyzer(CFG const& _cfg, langutil::ErrorReporter& _errorReporter, size_t _threadCount):
+		m_cfg(_cfg), m_errorReporter(_errorReporter), m_threadCount(_threadCount) {}
 
+	/// Analyzes all function flows of the CFG. The flows are independent of each other and
+	/// are analyzed concurrently, while the diagnostics are reported in the order of the flows.
 	bool run();
 
 private:
-	void analyze(FunctionDefinition const& _function, ContractDefinition const* _contract, FunctionFlow const& _flow);
-	/// Checks for uninitialized variable accesses in the control flow between @param _entry and @param _exit.
-	/// @param _entry entry node
-	/// @param _exit exit node
+	/// Result of the analysis of a single function flow. Only depends on the flow itself.
+	struct FlowAnalysis
+	{
+		/// Variable accesses that are reachable from the entry without prior assignment
+		/// and whose paths reach the exit, in the order in which they are reported.
+		std::vector<VariableOccurrence const*> uninitializedAccesses;
+		/// Valid locations of nodes that cannot be reached from the entry.
+		std::set<langutil::SourceLocation> unreachable;
+	};
+
+	/// Computes the findings for @a _flow without touching anything outside the flow.
+	static FlowAnalysis analyzeFlow(FunctionFlow const& _flow);
+	/// @returns the accesses in the control flow between @param _entry and @param _exit
+	/// that can happen before the variable is assigned.
+	static std::vector<VariableOccurrence const*> findUninitializedAccesses(CFGNode const* _entry, CFGNode const* _exit);
+	/// @returns the locations of code ending in @param _exit, @param _revert or @param _transactionReturn
+	/// that can not be reached from @param _entry.
+	static std::set<langutil::SourceLocation> findUnreachable(CFGNode const* _entry, CFGNode const* _exit, CFGNode const* _revert, CFGNode const* _transactionReturn);
+
+	void report(FunctionDefinition const& _function, ContractDefinition const* _contract, FlowAnalysis const& _analysis);
+	/// Reports uninitialized variable accesses.
 	/// @param _emptyBody whether the body of the function is empty (true) or not (false)
 	/// @param _contractName name of the most derived contract, should be empty
 	///        if the function is also defined in it
-	void checkUninitializedAccess(CFGNode const* _entry, CFGNode const* _exit, bool _emptyBody, std::optional<std::string> _contractName = {});
-	/// Checks for unreachable code, i.e. code ending in @param _exit, @param _revert or @param _transactionReturn
-	/// that can not be reached from @param _entry.
-	void checkUnreachable(CFGNode const* _entry, CFGNode const* _exit, CFGNode const* _revert, CFGNode const* _transactionReturn);
+	void reportUninitializedAccesses(std::vector<VariableOccurrence const*> const& _accesses, bool _emptyBody, std::optional<std::string> _contractName = {});
+	/// Reports unreachable code, merging overlapping locations.
+	void reportUnreachable(std::set<langutil::SourceLocation> const& _unreachable);
 
 	CFG const& m_cfg;
 	langutil::ErrorReporter& m_errorReporter;
+	size_t m_threadCount;
 
 	std::set<langutil::SourceLocation> m_unreachableLocationsAlreadyWarnedFor;
 	std::set<VariableDeclaration const*> m_unassignedReturnVarsAlreadyWarnedFor;
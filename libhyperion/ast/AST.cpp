@@ -59,6 +59,13 @@ ASTNode::ASTNode(int64_t _id, SourceLocation _location):
 {
 }
 
+void ASTNode::shiftIDs(std::vector<std::weak_ptr<ASTNode>> const& _nodes, int64_t _offset)
+{
+	for (std::weak_ptr<ASTNode> const& node: _nodes)
+		if (std::shared_ptr<ASTNode> existingNode = node.lock())
+			existingNode->m_id = static_cast<size_t>(existingNode->id() + _offset);
+}
+
 Declaration const* ASTNode::referencedDeclaration(Expression const& _expression)
 {
 	if (auto const* memberAccess = dynamic_cast<MemberAccess const*>(&_expression))
@@ -80,6 +80,10 @@ public:
 
 	/// @returns an identifier of this AST node that is unique for a single compilation run.
 	int64_t id() const { return int64_t(m_id); }
+	/// Adds @a _offset to the IDs of those of @a _nodes that still exist.
+	/// Used to renumber source units that were parsed independently of each other,
+	/// must not be called once anything has been keyed by node ID.
+	static void shiftIDs(std::vector<std::weak_ptr<ASTNode>> const& _nodes, int64_t _offset);
 
 	virtual void accept(ASTVisitor& _visitor) = 0;
 	virtual void accept(ASTConstVisitor& _visitor) const = 0;
@@ -126,7 +130,7 @@ public:
 	///@}
 
 protected:
-	size_t const m_id = 0;
+	size_t m_id = 0;
 
 	template <class T>
 	T& initAnnotation() const
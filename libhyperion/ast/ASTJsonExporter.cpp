@@ -200,7 +200,7 @@ Json::Value ASTJsonExporter::inlineAssemblyIdentifierToJson(std::pair<yul::Ident
 
 void ASTJsonExporter::print(std::ostream& _stream, ASTNode const& _node, util::JsonFormat const& _format)
 {
-	_stream << util::jsonPrint(toJson(_node), _format);
+	util::jsonPrint(_stream, toJson(_node), _format);
 }
 
 Json::Value ASTJsonExporter::toJson(ASTNode const& _node)
@@ -261,24 +261,35 @@ std::string parenthesizeUserIdentifier(std::string const& _internal)
 
 std::string Type::escapeIdentifier(std::string const& _identifier)
 {
-	std::string ret = _identifier;
-	// FIXME: should be _$$$_
-	boost::algorithm::replace_all(ret, "$", "$$$");
-	boost::algorithm::replace_all(ret, ",", "_$_");
-	boost::algorithm::replace_all(ret, "(", "$_");
-	boost::algorithm::replace_all(ret, ")", "_$");
+	// Single pass, none of the replacements contains a character that is replaced itself.
+	std::string ret;
+	ret.reserve(_identifier.size());
+	for (char c: _identifier)
+		switch (c)
+		{
+		// FIXME: should be _$$$_
+		case '$': ret += "$$$"; break;
+		case ',': ret += "_$_"; break;
+		case '(': ret += "$_"; break;
+		case ')': ret += "_$"; break;
+		default: ret += c; break;
+		}
 	return ret;
 }
 
-std::string Type::identifier() const
+std::string const& Type::identifier() const
 {
-	std::string ret = escapeIdentifier(richIdentifier());
-	hypAssert(ret.find_first_of("0123456789") != 0, "Identifier cannot start with a number.");
-	hypAssert(
-		ret.find_first_not_of("0123456789abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMONPQRSTUVWXYZ_$") == std::string::npos,
-		"Identifier contains invalid characters."
-	);
-	return ret;
+	if (!m_identifier)
+	{
+		std::string ret = escapeIdentifier(richIdentifier());
+		hypAssert(ret.find_first_of("0123456789") != 0, "Identifier cannot start with a number.");
+		hypAssert(
+			ret.find_first_not_of("0123456789abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMONPQRSTUVWXYZ_$") == std::string::npos,
+			"Identifier contains invalid characters."
+		);
+		m_identifier = std::move(ret);
+	}
+	return *m_identifier;
 }
 
 Type const* Type::commonType(Type const* _a, Type const* _b)
@@ -211,7 +211,8 @@ public:
 	/// only if they have the same identifier.
 	/// The identifier should start with "t_".
 	/// Will not contain any character which would be invalid as an identifier.
-	std::string identifier() const;
+	/// Computed on first use only, since types do not change after construction.
+	std::string const& identifier() const;
 
 	/// More complex identifier strings use "parentheses", where $_ is interpreted as
 	/// "opening parenthesis", _$ as "closing parenthesis", _$_ as "comma" and any $ that
@@ -433,6 +434,8 @@ protected:
 	mutable std::map<ASTNode const*, std::unique_ptr<MemberList>> m_members;
 	mutable std::optional<std::vector<std::tuple<std::string, Type const*>>> m_stackItems;
 	mutable std::optional<size_t> m_stackSize;
+	/// Cache for identifier(), which is requested over and over again during code generation.
+	mutable std::optional<std::string> m_identifier;
 };
 
 /**
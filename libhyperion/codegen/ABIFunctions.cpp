@@ -1568,7 +1568,7 @@ std::string ABIFunctions::arrayStoreLengthForEncodingFunction(ArrayType const& _
 
 std::string ABIFunctions::createFunction(std::string const& _name, std::function<std::string ()> const& _creator)
 {
-	return m_functionCollector.createFunction(_name, _creator);
+	return m_functionCollector.createSharedFunction(_name, _creator);
 }
 
 size_t ABIFunctions::headSize(TypePointers const& _targetTypes)
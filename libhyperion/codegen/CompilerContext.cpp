@@ -548,7 +548,8 @@ void CompilerContext::optimizeYul(yul::Object& _object, yul::QRVMDialect const&
 		_optimiserSettings.yulOptimiserSteps,
 		_optimiserSettings.yulOptimiserCleanupSteps,
 		isCreation? std::nullopt : std::make_optional(_optimiserSettings.expectedExecutionsPerDeployment),
-		_externalIdentifiers
+		_externalIdentifiers,
+		_optimiserSettings.yulOptimiserMinRoundGain
 	);
 
 #ifdef HYP_OUTPUT_ASM
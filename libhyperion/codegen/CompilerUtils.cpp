@@ -94,7 +94,7 @@ void CompilerUtils::revertWithStringData(Type const& _argumentType)
 {
 	hypAssert(_argumentType.isImplicitlyConvertibleTo(*TypeProvider::fromElementaryTypeName("string memory")));
 	fetchFreeMemoryPointer();
-	m_context << (u512(util::selectorFromSignatureU256("Error(string)")) << (VMWordBits - 256));
+	m_context << (u512(util::c_errorStringSelector) << (VMWordBits - 32));
 	m_context << Instruction::DUP2 << Instruction::MSTORE;
 	m_context << u256(4) << Instruction::ADD;
 	// Stack: <string data> <mem pos of encoding start>
@@ -269,7 +269,7 @@ size_t ContractCompiler::deployLibrary(ContractDefinition const& _contract)
 		("pushOpcode", toCompactHexWithPrefix(pushOpcode))
 		("AddressBytes", std::to_string(AddressBytes))
 		("addressMstoreOffset", std::to_string(addressMstoreOffset))
-		("panicSelector", (u512(util::selectorFromSignatureU256("Panic(uint256)")) << (VMWordBits - 256)).str())
+		("panicSelector", (u512(util::c_panicSelector) << (VMWordBits - 32)).str())
 		("panicCode", "0")
 		.render(),
 		{"subSize", "subOffset"}
@@ -1061,7 +1061,7 @@ void ContractCompiler::handleCatch(std::vector<ASTPointer<TryCatchClause>> const
 		);
 
 		// stack: <selector>
-		m_context << Instruction::DUP1 << util::selectorFromSignatureU32("Error(string)") << Instruction::EQ;
+		m_context << Instruction::DUP1 << util::c_errorStringSelector << Instruction::EQ;
 		m_context << Instruction::ISZERO;
 		m_context.appendConditionalJumpTo(panicTag);
 		m_context << Instruction::POP; // remove selector
@@ -1092,7 +1092,7 @@ void ContractCompiler::handleCatch(std::vector<ASTPointer<TryCatchClause>> const
 		);
 
 		// stack: <selector>
-		m_context << util::selectorFromSignatureU32("Panic(uint256)") << Instruction::EQ;
+		m_context << util::c_panicSelector << Instruction::EQ;
 		m_context << Instruction::ISZERO;
 		m_context.appendConditionalJumpTo(fallbackTag);
 
@@ -23,15 +23,19 @@
 #include <libhyperion/codegen/MultiUseYulFunctionCollector.h>
 
 #include <liblangutil/Exceptions.h>
+#include <libhyputil/CommonData.h>
 #include <libhyputil/Whiskers.h>
 #include <libhyputil/StringUtils.h>
 
+#include <algorithm>
+
 using namespace hyperion;
 using namespace hyperion::frontend;
 using namespace hyperion::util;
 
 std::string MultiUseYulFunctionCollector::requestedFunctions()
 {
+	hypAssert(m_recordings.empty(), "");
 	std::string result = std::move(m_code);
 	m_code.clear();
 	m_requestedFunctions.clear();
@@ -40,13 +44,13 @@ std::string MultiUseYulFunctionCollector::requestedFunctions()
 
 std::string MultiUseYulFunctionCollector::createFunction(std::string const& _name, std::function<std::string()> const& _creator)
 {
+	// Functions generated outside of the shared cache cannot be restored from it.
+	if (!m_recordings.empty())
+		m_recordings.back().shareable = false;
 	if (!m_requestedFunctions.count(_name))
 	{
 		m_requestedFunctions.insert(_name);
-		std::string fun = _creator();
-		hypAssert(!fun.empty(), "");
-		hypAssert(fun.find("function " + _name + "(") != std::string::npos, "Function not properly named.");
-		m_code += std::move(fun);
+		m_code += generateFunction(_name, _creator);
 	}
 	return _name;
 }
@@ -57,15 +61,70 @@ std::string MultiUseYulFunctionCollector::createFunction(
 )
 {
 	hypAssert(!_name.empty(), "");
-	if (!m_requestedFunctions.count(_name))
+	return createFunction(_name, functionFromBody(_name, _creator));
+}
+
+std::string MultiUseYulFunctionCollector::createSharedFunction(std::string const& _name, std::function<std::string()> const& _creator)
+{
+	if (!m_sharedFunctions)
+		return createFunction(_name, _creator);
+
+	if (!m_recordings.empty())
+		m_recordings.back().dependencies.push_back(_name);
+	if (m_requestedFunctions.count(_name))
+		return _name;
+	if (auto const* cachedFunction = valueOrNullptr(m_sharedFunctions->functions, _name))
 	{
-		m_requestedFunctions.insert(_name);
+		addCachedFunction(_name, *cachedFunction);
+		return _name;
+	}
+
+	m_requestedFunctions.insert(_name);
+	m_recordings.emplace_back();
+	std::string fun = generateFunction(_name, _creator);
+	Recording recording = std::move(m_recordings.back());
+	m_recordings.pop_back();
+	// Only cache the function if everything it requested can be restored from the cache as well.
+	if (
+		recording.shareable &&
+		std::all_of(recording.dependencies.begin(), recording.dependencies.end(), [&](std::string const& _dependency) {
+			return m_sharedFunctions->functions.count(_dependency) > 0;
+		})
+	)
+		m_sharedFunctions->functions[_name] = {std::move(recording.dependencies), fun};
+	m_code += std::move(fun);
+	return _name;
+}
+
+std::string MultiUseYulFunctionCollector::createSharedFunction(
+	std::string const& _name,
+	std::function<std::string(std::vector<std::string>&, std::vector<std::string>&)> const& _creator
+)
+{
+	hypAssert(!_name.empty(), "");
+	return createSharedFunction(_name, functionFromBody(_name, _creator));
+}
+
+std::string MultiUseYulFunctionCollector::generateFunction(std::string const& _name, std::function<std::string()> const& _creator)
+{
+	std::string fun = _creator();
+	hypAssert(!fun.empty(), "");
+	hypAssert(fun.find("function " + _name + "(") != std::string::npos, "Function not properly named.");
+	return fun;
+}
+
+std::function<std::string()> MultiUseYulFunctionCollector::functionFromBody(
+	std::string const& _name,
+	std::function<std::string(std::vector<std::string>&, std::vector<std::string>&)> const& _creator
+)
+{
+	return [&_name, &_creator]() {
 		std::vector<std::string> arguments;
 		std::vector<std::string> returnParameters;
 		std::string body = _creator(arguments, returnParameters);
 		hypAssert(!body.empty(), "");
 
-		m_code += Whiskers(R"(
+		return Whiskers(R"(
 			function <functionName>(<args>)<?+retParams> -> <retParams></+retParams> {
 				<body>
 			}
@@ -75,6 +134,19 @@ std::string MultiUseYulFunctionCollector::createFunction(
 		("retParams", joinHumanReadable(returnParameters))
 		("body", body)
 		.render();
-	}
-	return _name;
+	};
+}
+
+void MultiUseYulFunctionCollector::addCachedFunction(
+	std::string const& _name,
+	SharedYulFunctionCache::Function const& _function
+)
+{
+	// Same order as if the function had been generated: the name is reserved first, then the
+	// requested functions are added and finally the function itself.
+	m_requestedFunctions.insert(_name);
+	for (std::string const& dependency: _function.dependencies)
+		if (!m_requestedFunctions.count(dependency))
+			addCachedFunction(dependency, m_sharedFunctions->functions.at(dependency));
+	m_code += _function.code;
 }
@@ -24,12 +24,32 @@
 
 #include <functional>
 #include <map>
+#include <memory>
 #include <string>
 #include <set>
+#include <vector>
 
 namespace hyperion::frontend
 {
 
+/**
+ * Yul functions generated for one contract that can be reused by the other contracts of the
+ * same compilation. This only applies to functions whose code depends on nothing but their name,
+ * the QRVM version and the revert strings setting, i.e. the ones requested via
+ * MultiUseYulFunctionCollector::createSharedFunction. The owner has to make sure that a cache
+ * is only used with a single combination of these settings.
+ */
+struct SharedYulFunctionCache
+{
+	struct Function
+	{
+		/// Names of the shared functions requested while generating the function, in request order.
+		std::vector<std::string> dependencies;
+		std::string code;
+	};
+	std::map<std::string, Function> functions;
+};
+
 /**
  * Container of (unparsed) Yul functions identified by name which are meant to be generated
  * only once.
@@ -37,6 +57,11 @@ namespace hyperion::frontend
 class MultiUseYulFunctionCollector
 {
 public:
+	MultiUseYulFunctionCollector() = default;
+	explicit MultiUseYulFunctionCollector(std::shared_ptr<SharedYulFunctionCache> _sharedFunctions):
+		m_sharedFunctions(std::move(_sharedFunctions))
+	{}
+
 	/// Helper function that uses @a _creator to create a function and add it to
 	/// @a m_requestedFunctions if it has not been created yet and returns @a _name in both
 	/// cases.
@@ -47,6 +72,17 @@ public:
 		std::function<std::string(std::vector<std::string>&, std::vector<std::string>&)> const& _creator
 	);
 
+	/// Same as createFunction, but takes the function (and the functions it requested) from
+	/// the shared cache if it was generated for another contract before.
+	/// Must only be used for functions whose code is fully determined by their name and
+	/// the settings of the cache.
+	std::string createSharedFunction(std::string const& _name, std::function<std::string()> const& _creator);
+
+	std::string createSharedFunction(
+		std::string const& _name,
+		std::function<std::string(std::vector<std::string>&, std::vector<std::string>&)> const& _creator
+	);
+
 	/// @returns concatenation of all generated functions in the order in which they were
 	/// generated.
 	/// Clears the internal list, i.e. calling it again will result in an
@@ -56,9 +92,32 @@ public:
 	/// @returns true IFF a function with the specified name has already been collected.
 	bool contains(std::string const& _name) const { return m_requestedFunctions.count(_name) > 0; }
 
+	std::shared_ptr<SharedYulFunctionCache> const& sharedFunctions() const { return m_sharedFunctions; }
+
 private:
+	/// Functions requested while generating a shared function.
+	struct Recording
+	{
+		std::vector<std::string> dependencies;
+		/// False if a function outside of the shared cache was requested.
+		bool shareable = true;
+	};
+
+	/// Runs @a _creator and checks that it produced a function called @a _name.
+	static std::string generateFunction(std::string const& _name, std::function<std::string()> const& _creator);
+	/// Wraps the body returned by @a _creator into a function called @a _name.
+	static std::function<std::string()> functionFromBody(
+		std::string const& _name,
+		std::function<std::string(std::vector<std::string>&, std::vector<std::string>&)> const& _creator
+	);
+	/// Adds the cached function @a _name after the functions it requested when it was generated.
+	void addCachedFunction(std::string const& _name, SharedYulFunctionCache::Function const& _function);
+
 	std::set<std::string> m_requestedFunctions;
 	std::string m_code;
+	std::shared_ptr<SharedYulFunctionCache> m_sharedFunctions;
+	/// One entry per shared function that is currently being generated, innermost last.
+	std::vector<Recording> m_recordings;
 };
 
 }
@@ -39,7 +39,7 @@ using namespace std::string_literals;
 std::string YulUtilFunctions::identityFunction()
 {
 	std::string functionName = "identity";
-	return m_functionCollector.createFunction("identity", [&](std::vector<std::string>& _args, std::vector<std::string>& _rets) {
+	return m_functionCollector.createSharedFunction("identity", [&](std::vector<std::string>& _args, std::vector<std::string>& _rets) {
 		_args.push_back("value");
 		_rets.push_back("ret");
 		return "ret := value";
@@ -54,7 +54,7 @@ std::string YulUtilFunctions::copyToMemoryFunction(bool _fromCalldata, bool _cle
 		"_to_memory"s +
 		(_cleanup ? "_with_cleanup"s : ""s);
 
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createSharedFunction(functionName, [&]() {
 		if (_fromCalldata)
 		{
 			return Whiskers(R"(
@@ -99,7 +99,7 @@ std::string YulUtilFunctions::copyLiteralToMemoryFunction(std::string const& _li
 {
 	std::string functionName = "copy_literal_to_memory_" + util::toHex(util::keccak256(_literal).asBytes());
 
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createSharedFunction(functionName, [&]() {
 		return Whiskers(R"(
 			function <functionName>() -> memPtr {
 				memPtr := <arrayAllocationFunction>(<size>)
@@ -119,7 +119,7 @@ std::string YulUtilFunctions::storeLiteralInMemoryFunction(std::string const& _l
 {
 	std::string functionName = "store_literal_in_memory_" + util::toHex(util::keccak256(_literal).asBytes());
 
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createSharedFunction(functionName, [&]() {
 		size_t words = (_literal.length() + VMWordAlignmentMask) / VMWordBytes;
 		std::vector<std::map<std::string, std::string>> wordParams(words);
 		for (size_t i = 0; i < words; ++i)
@@ -153,7 +153,7 @@ std::string YulUtilFunctions::copyLiteralToStorageFunction(std::string const& _l
 {
 	std::string functionName = "copy_literal_to_storage_" + util::toHex(util::keccak256(_literal).asBytes());
 
-	return m_functionCollector.createFunction(functionName, [&](std::vector<std::string>& _args, std::vector<std::string>&) {
+	return m_functionCollector.createSharedFunction(functionName, [&](std::vector<std::string>& _args, std::vector<std::string>&) {
 		_args = {"slot"};
 
 		if (_literal.size() >= VMWordBytes)
@@ -218,7 +218,7 @@ std::string YulUtilFunctions::requireOrAssertFunction(bool _assert, Type const*
 
 	hypAssert(!_assert || !_messageType, "Asserts can't have messages!");
 
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createSharedFunction(functionName, [&]() {
 		if (!_messageType)
 			return Whiskers(R"(
 				function <functionName>(condition) {
@@ -230,9 +230,9 @@ std::string YulUtilFunctions::requireOrAssertFunction(bool _assert, Type const*
 			.render();
 
 		int const hashHeaderSize = 4;
-		// selectorFromSignatureU256 returns sel << 224 (u256 left-aligned).
+		// The selector left-aligned in a u256.
 		// In a VMWordBits-bit VM, we need sel at the top: shift up by (VMWordBits - 256) more bits.
-		u256 const errorHash = util::selectorFromSignatureU256("Error(string)");
+		u256 const errorHash = u256(util::c_errorStringSelector) << (256 - 32);
 
 		std::string const encodeFunc = ABIFunctions(m_qrvmVersion, m_revertStrings, m_functionCollector)
 			.tupleEncoder(
@@ -267,7 +267,7 @@ std::string YulUtilFunctions::requireOrAssertFunction(bool _assert, Type const*
 std::string YulUtilFunctions::leftAlignFunction(Type const& _type)
 {
 	std::string functionName = std::string("leftAlign_") + _type.identifier();
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createSharedFunction(functionName, [&]() {
 		Whiskers templ(R"(
 			function <functionName>(value) -> aligned {
 				<body>
@@ -329,7 +329,7 @@ std::string YulUtilFunctions::shiftLeftFunction(size_t _numBits)
 	hypAssert(_numBits < VMWordBits, "");
 
 	std::string functionName = "shift_left_" + std::to_string(_numBits);
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createSharedFunction(functionName, [&]() {
 		return
 			Whiskers(R"(
 			function <functionName>(value) -> newValue {
@@ -346,7 +346,7 @@ std::string YulUtilFunctions::shiftLeftFunction(size_t _numBits)
 std::string YulUtilFunctions::shiftLeftFunctionDynamic()
 {
 	std::string functionName = "shift_left_dynamic";
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createSharedFunction(functionName, [&]() {
 		return
 			Whiskers(R"(
 			function <functionName>(bits, value) -> newValue {
@@ -367,7 +367,7 @@ std::string YulUtilFunctions::shiftRightFunction(size_t _numBits)
 	// the opcodes SAR and SDIV behave differently with regards to rounding!
 
 	std::string functionName = "shift_right_" + std::to_string(_numBits) + "_unsigned";
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createSharedFunction(functionName, [&]() {
 		return
 			Whiskers(R"(
 			function <functionName>(value) -> newValue {
@@ -384,7 +384,7 @@ std::string YulUtilFunctions::shiftRightFunction(size_t _numBits)
 std::string YulUtilFunctions::shiftRightFunctionDynamic()
 {
 	std::string const functionName = "shift_right_unsigned_dynamic";
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createSharedFunction(functionName, [&]() {
 		return
 			Whiskers(R"(
 			function <functionName>(bits, value) -> newValue {
@@ -400,7 +400,7 @@ std::string YulUtilFunctions::shiftRightFunctionDynamic()
 std::string YulUtilFunctions::shiftRightSignedFunctionDynamic()
 {
 	std::string const functionName = "shift_right_signed_dynamic";
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createSharedFunction(functionName, [&]() {
 		return
 			Whiskers(R"(
 			function <functionName>(bits, value) -> result {
@@ -420,7 +420,7 @@ std::string YulUtilFunctions::typedShiftLeftFunction(Type const& _type, Type con
 	hypAssert(_amountType.category() == Type::Category::Integer, "");
 	hypAssert(!dynamic_cast<IntegerType const&>(_amountType).isSigned(), "");
 	std::string const functionName = "shift_left_" + _type.identifier() + "_" + _amountType.identifier();
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createSharedFunction(functionName, [&]() {
 		return
 			Whiskers(R"(
 			function <functionName>(value, bits) -> result {
@@ -446,7 +446,7 @@ std::string YulUtilFunctions::typedShiftRightFunction(Type const& _type, Type co
 	bool valueSigned = integerType && integerType->isSigned();
 
 	std::string const functionName = "shift_right_" + _type.identifier() + "_" + _amountType.identifier();
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createSharedFunction(functionName, [&]() {
 		return
 			Whiskers(R"(
 			function <functionName>(value, bits) -> result {
@@ -469,7 +469,7 @@ std::string YulUtilFunctions::updateByteSliceFunction(size_t _numBytes, size_t _
 	size_t numBits = _numBytes * 8;
 	size_t shiftBits = _shiftBytes * 8;
 	std::string functionName = "update_byte_slice_" + std::to_string(_numBytes) + "_shift_" + std::to_string(_shiftBytes);
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createSharedFunction(functionName, [&]() {
 		return
 			Whiskers(R"(
 			function <functionName>(value, toInsert) -> result {
@@ -491,7 +491,7 @@ std::string YulUtilFunctions::updateByteSliceFunctionDynamic(size_t _numBytes)
 	hypAssert(_numBytes <= VMWordBytes, "");
 	size_t numBits = _numBytes * 8;
 	std::string functionName = "update_byte_slice_dynamic" + std::to_string(_numBytes);
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createSharedFunction(functionName, [&]() {
 		return
 			Whiskers(R"(
 			function <functionName>(value, shiftBytes, toInsert) -> result {
@@ -512,7 +512,7 @@ std::string YulUtilFunctions::updateByteSliceFunctionDynamic(size_t _numBytes)
 std::string YulUtilFunctions::maskBytesFunctionDynamic()
 {
 	std::string functionName = "mask_bytes_dynamic";
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createSharedFunction(functionName, [&]() {
 		return Whiskers(R"(
 			function <functionName>(data, bytes) -> result {
 				let mask := not(<shr>(mul(8, bytes), not(0)))
@@ -528,7 +528,7 @@ std::string YulUtilFunctions::maskLowerOrderBytesFunction(size_t _bytes)
 {
 	std::string functionName = "mask_lower_order_bytes_" + std::to_string(_bytes);
 	hypAssert(_bytes <= VMWordBytes, "");
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createSharedFunction(functionName, [&]() {
 		return Whiskers(R"(
 			function <functionName>(data) -> result {
 				result := and(data, <mask>)
@@ -542,7 +542,7 @@ std::string YulUtilFunctions::maskLowerOrderBytesFunction(size_t _bytes)
 std::string YulUtilFunctions::maskLowerOrderBytesFunctionDynamic()
 {
 	std::string functionName = "mask_lower_order_bytes_dynamic";
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createSharedFunction(functionName, [&]() {
 		return Whiskers(R"(
 			function <functionName>(data, bytes) -> result {
 				let mask := not(<shl>(mul(8, bytes), not(0)))
@@ -557,7 +557,7 @@ std::string YulUtilFunctions::maskLowerOrderBytesFunctionDynamic()
 std::string YulUtilFunctions::roundUpFunction()
 {
 	std::string functionName = "round_up_to_mul_of_" + std::to_string(VMWordBytes);
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createSharedFunction(functionName, [&]() {
 		return
 			Whiskers(R"(
 			function <functionName>(value) -> result {
@@ -572,7 +572,7 @@ std::string YulUtilFunctions::roundUpFunction()
 
 std::string YulUtilFunctions::divide32CeilFunction()
 {
-	return m_functionCollector.createFunction(
+	return m_functionCollector.createSharedFunction(
 		"divide_by_" + std::to_string(VMWordBytes) + "_ceil",
 		[&](std::vector<std::string>& _args, std::vector<std::string>& _ret) {
 			_args = {"value"};
@@ -585,7 +585,7 @@ std::string YulUtilFunctions::divide32CeilFunction()
 std::string YulUtilFunctions::overflowCheckedIntAddFunction(IntegerType const& _type)
 {
 	std::string functionName = "checked_add_" + _type.identifier();
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createSharedFunction(functionName, [&]() {
 		return
 			Whiskers(R"(
 			function <functionName>(x, y) -> sum {
@@ -629,7 +629,7 @@ std::string YulUtilFunctions::overflowCheckedIntAddFunction(IntegerType const& _
 std::string YulUtilFunctions::wrappingIntAddFunction(IntegerType const& _type)
 {
 	std::string functionName = "wrapping_add_" + _type.identifier();
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createSharedFunction(functionName, [&]() {
 		return
 			Whiskers(R"(
 			function <functionName>(x, y) -> sum {
@@ -645,7 +645,7 @@ std::string YulUtilFunctions::wrappingIntAddFunction(IntegerType const& _type)
 std::string YulUtilFunctions::overflowCheckedIntMulFunction(IntegerType const& _type)
 {
 	std::string functionName = "checked_mul_" + _type.identifier();
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createSharedFunction(functionName, [&]() {
 		return
 			// Multiplication by zero could be treated separately and directly return zero.
 			Whiskers(R"(
@@ -699,7 +699,7 @@ std::string YulUtilFunctions::overflowCheckedIntMulFunction(IntegerType const& _
 std::string YulUtilFunctions::wrappingIntMulFunction(IntegerType const& _type)
 {
 	std::string functionName = "wrapping_mul_" + _type.identifier();
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createSharedFunction(functionName, [&]() {
 		return
 			Whiskers(R"(
 			function <functionName>(x, y) -> product {
@@ -715,7 +715,7 @@ std::string YulUtilFunctions::wrappingIntMulFunction(IntegerType const& _type)
 std::string YulUtilFunctions::overflowCheckedIntDivFunction(IntegerType const& _type)
 {
 	std::string functionName = "checked_div_" + _type.identifier();
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createSharedFunction(functionName, [&]() {
 		return
 			Whiskers(R"(
 			function <functionName>(x, y) -> r {
@@ -745,7 +745,7 @@ std::string YulUtilFunctions::overflowCheckedIntDivFunction(IntegerType const& _
 std::string YulUtilFunctions::wrappingIntDivFunction(IntegerType const& _type)
 {
 	std::string functionName = "wrapping_div_" + _type.identifier();
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createSharedFunction(functionName, [&]() {
 		return
 			Whiskers(R"(
 			function <functionName>(x, y) -> r {
@@ -766,7 +766,7 @@ std::string YulUtilFunctions::wrappingIntDivFunction(IntegerType const& _type)
 std::string YulUtilFunctions::intModFunction(IntegerType const& _type)
 {
 	std::string functionName = "mod_" + _type.identifier();
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createSharedFunction(functionName, [&]() {
 		return
 			Whiskers(R"(
 			function <functionName>(x, y) -> r {
@@ -787,7 +787,7 @@ std::string YulUtilFunctions::intModFunction(IntegerType const& _type)
 std::string YulUtilFunctions::overflowCheckedIntSubFunction(IntegerType const& _type)
 {
 	std::string functionName = "checked_sub_" + _type.identifier();
-	return m_functionCollector.createFunction(functionName, [&] {
+	return m_functionCollector.createSharedFunction(functionName, [&] {
 		return
 			Whiskers(R"(
 			function <functionName>(x, y) -> diff {
@@ -831,7 +831,7 @@ std::string YulUtilFunctions::overflowCheckedIntSubFunction(IntegerType const& _
 std::string YulUtilFunctions::wrappingIntSubFunction(IntegerType const& _type)
 {
 	std::string functionName = "wrapping_sub_" + _type.identifier();
-	return m_functionCollector.createFunction(functionName, [&] {
+	return m_functionCollector.createSharedFunction(functionName, [&] {
 		return
 			Whiskers(R"(
 			function <functionName>(x, y) -> diff {
@@ -852,7 +852,7 @@ std::string YulUtilFunctions::overflowCheckedIntExpFunction(
 	hypAssert(!_exponentType.isSigned(), "");
 
 	std::string functionName = "checked_exp_" + _type.identifier() + "_" + _exponentType.identifier();
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createSharedFunction(functionName, [&]() {
 		return
 			Whiskers(R"(
 			function <functionName>(base, exponent) -> power {
@@ -889,7 +889,7 @@ std::string YulUtilFunctions::overflowCheckedIntLiteralExpFunction(
 
 	std::string functionName = "checked_exp_" + _baseType.richIdentifier() + "_" + _exponentType.identifier();
 
-	return m_functionCollector.createFunction(functionName, [&]()
+	return m_functionCollector.createSharedFunction(functionName, [&]()
 	{
 		// Converts a bigint number into u256 (negative numbers represented in two's complement form.)
 		// We assume that `_v` fits in 256 bits.
@@ -1003,7 +1003,7 @@ std::string YulUtilFunctions::overflowCheckedUnsignedExpFunction()
 	hypAssert(pow(bigint(306), 32) >= pow(bigint(2), 256), "");
 
 	std::string functionName = "checked_exp_unsigned";
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createSharedFunction(functionName, [&]() {
 		return
 			Whiskers(R"(
 			function <functionName>(base, exponent, max) -> power {
@@ -1051,7 +1051,7 @@ std::string YulUtilFunctions::overflowCheckedUnsignedExpFunction()
 std::string YulUtilFunctions::overflowCheckedSignedExpFunction()
 {
 	std::string functionName = "checked_exp_signed";
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createSharedFunction(functionName, [&]() {
 		return
 			Whiskers(R"(
 			function <functionName>(base, exponent, min, max) -> power {
@@ -1107,7 +1107,7 @@ std::string YulUtilFunctions::overflowCheckedExpLoopFunction()
 	// This function does not include the final multiplication.
 
 	std::string functionName = "checked_exp_helper";
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createSharedFunction(functionName, [&]() {
 		return
 			Whiskers(R"(
 			function <functionName>(_power, _base, exponent, max) -> power, base {
@@ -1146,7 +1146,7 @@ std::string YulUtilFunctions::wrappingIntExpFunction(
 	hypAssert(!_exponentType.isSigned(), "");
 
 	std::string functionName = "wrapping_exp_" + _type.identifier() + "_" + _exponentType.identifier();
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createSharedFunction(functionName, [&]() {
 		return
 			Whiskers(R"(
 			function <functionName>(base, exponent) -> power {
@@ -1165,7 +1165,7 @@ std::string YulUtilFunctions::wrappingIntExpFunction(
 std::string YulUtilFunctions::arrayLengthFunction(ArrayType const& _type)
 {
 	std::string functionName = "array_length_" + _type.identifier();
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createSharedFunction(functionName, [&]() {
 		Whiskers w(R"(
 			function <functionName>(value<?dynamic><?calldata>, len</calldata></dynamic>) -> length {
 				<?dynamic>
@@ -1207,7 +1207,7 @@ std::string YulUtilFunctions::arrayLengthFunction(ArrayType const& _type)
 std::string YulUtilFunctions::extractByteArrayLengthFunction()
 {
 	std::string functionName = "extract_byte_array_length";
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createSharedFunction(functionName, [&]() {
 		Whiskers w(R"(
 			function <functionName>(data) -> length {
 				length := div(data, 2)
@@ -1237,7 +1237,7 @@ std::string YulUtilFunctions::resizeArrayFunction(ArrayType const& _type)
 		return resizeDynamicByteArrayFunction(_type);
 
 	std::string functionName = "resize_array_" + _type.identifier();
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createSharedFunction(functionName, [&]() {
 		Whiskers templ(R"(
 			function <functionName>(array, newLen) {
 				if gt(newLen, <maxArrayLength>) {
@@ -1276,7 +1276,7 @@ std::string YulUtilFunctions::cleanUpStorageArrayEndFunction(ArrayType const& _t
 	hypUnimplementedAssert(_type.baseType()->storageBytes() <= VMWordBytes);
 
 	std::string functionName = "cleanup_storage_array_end_" + _type.identifier();
-	return m_functionCollector.createFunction(functionName, [&](std::vector<std::string>& _args, std::vector<std::string>&) {
+	return m_functionCollector.createSharedFunction(functionName, [&](std::vector<std::string>& _args, std::vector<std::string>&) {
 		_args = {"array", "len", "startIndex"};
 		return Whiskers(R"(
 			if lt(startIndex, len) {
@@ -1309,7 +1309,7 @@ std::string YulUtilFunctions::cleanUpStorageArrayEndFunction(ArrayType const& _t
 std::string YulUtilFunctions::resizeDynamicByteArrayFunction(ArrayType const& _type)
 {
 	std::string functionName = "resize_array_" + _type.identifier();
-	return m_functionCollector.createFunction(functionName, [&](std::vector<std::string>& _args, std::vector<std::string>&) {
+	return m_functionCollector.createSharedFunction(functionName, [&](std::vector<std::string>& _args, std::vector<std::string>&) {
 		_args = {"array", "newLen"};
 		return Whiskers(R"(
 			let data := sload(array)
@@ -1336,7 +1336,7 @@ std::string YulUtilFunctions::cleanUpDynamicByteArrayEndSlotsFunction(ArrayType
 	hypAssert(_type.isDynamicallySized(), "");
 
 	std::string functionName = "clean_up_bytearray_end_slots_" + _type.identifier();
-	return m_functionCollector.createFunction(functionName, [&](std::vector<std::string>& _args, std::vector<std::string>&) {
+	return m_functionCollector.createSharedFunction(functionName, [&](std::vector<std::string>& _args, std::vector<std::string>&) {
 		_args = {"array", "len", "startIndex"};
 		return Whiskers(R"(
 			if gt(len, <alignmentMask>) {
@@ -1359,7 +1359,7 @@ std::string YulUtilFunctions::cleanUpDynamicByteArrayEndSlotsFunction(ArrayType
 std::string YulUtilFunctions::decreaseByteArraySizeFunction(ArrayType const& _type)
 {
 	std::string functionName = "byte_array_decrease_size_" + _type.identifier();
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createSharedFunction(functionName, [&]() {
 		return Whiskers(R"(
 			function <functionName>(array, data, oldLen, newLen) {
 				switch lt(newLen, <wordSize>)
@@ -1404,7 +1404,7 @@ std::string YulUtilFunctions::decreaseByteArraySizeFunction(ArrayType const& _ty
 std::string YulUtilFunctions::increaseByteArraySizeFunction(ArrayType const& _type)
 {
 	std::string functionName = "byte_array_increase_size_" + _type.identifier();
-	return m_functionCollector.createFunction(functionName, [&](std::vector<std::string>& _args, std::vector<std::string>&) {
+	return m_functionCollector.createSharedFunction(functionName, [&](std::vector<std::string>& _args, std::vector<std::string>&) {
 		_args = {"array", "data", "oldLen", "newLen"};
 		return Whiskers(R"(
 			if gt(newLen, <maxArrayLength>) { <panic>() }
@@ -1440,7 +1440,7 @@ std::string YulUtilFunctions::increaseByteArraySizeFunction(ArrayType const& _ty
 std::string YulUtilFunctions::byteArrayTransitLongToShortFunction(ArrayType const& _type)
 {
 	std::string functionName = "transit_byte_array_long_to_short_" + _type.identifier();
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createSharedFunction(functionName, [&]() {
 		return Whiskers(R"(
 			function <functionName>(array, len) {
 				// we need to copy elements from old array to new
@@ -1460,7 +1460,7 @@ std::string YulUtilFunctions::byteArrayTransitLongToShortFunction(ArrayType cons
 std::string YulUtilFunctions::shortByteArrayEncodeUsedAreaSetLengthFunction()
 {
 	std::string functionName = "extract_used_part_and_set_length_of_short_byte_array";
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createSharedFunction(functionName, [&]() {
 		return Whiskers(R"(
 			function <functionName>(data, len) -> used {
 				// we want to save only elements that are part of the array after resizing
@@ -1476,7 +1476,7 @@ std::string YulUtilFunctions::shortByteArrayEncodeUsedAreaSetLengthFunction()
 
 std::string YulUtilFunctions::longByteArrayStorageIndexAccessNoCheckFunction()
 {
-	return m_functionCollector.createFunction(
+	return m_functionCollector.createSharedFunction(
 		"long_byte_array_index_access_no_checks",
 		[&](std::vector<std::string>& _args, std::vector<std::string>& _returnParams) {
 			_args = {"array", "index"};
@@ -1503,7 +1503,7 @@ std::string YulUtilFunctions::storageArrayPopFunction(ArrayType const& _type)
 		return storageByteArrayPopFunction(_type);
 
 	std::string functionName = "array_pop_" + _type.identifier();
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createSharedFunction(functionName, [&]() {
 		return Whiskers(R"(
 			function <functionName>(array) {
 				let oldLen := <fetchLength>(array)
@@ -1532,7 +1532,7 @@ std::string YulUtilFunctions::storageByteArrayPopFunction(ArrayType const& _type
 	hypAssert(_type.isByteArrayOrString(), "");
 
 	std::string functionName = "byte_array_pop_" + _type.identifier();
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createSharedFunction(functionName, [&]() {
 		return Whiskers(R"(
 			function <functionName>(array) {
 				let data := sload(array)
@@ -1585,7 +1585,7 @@ std::string YulUtilFunctions::storageArrayPushFunction(ArrayType const& _type, T
 		_fromType->identifier() +
 		"_to_" +
 		_type.identifier();
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createSharedFunction(functionName, [&]() {
 		return Whiskers(R"(
 			function <functionName>(array <values>) {
 				<?isByteArrayOrString>
@@ -1651,7 +1651,7 @@ std::string YulUtilFunctions::storageArrayPushZeroFunction(ArrayType const& _typ
 	hypUnimplementedAssert(_type.baseType()->storageBytes() <= VMWordBytes, "Base type is not yet implemented.");
 
 	std::string functionName = "array_push_zero_" + _type.identifier();
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createSharedFunction(functionName, [&]() {
 		return Whiskers(R"(
 			function <functionName>(array) -> slot, offset {
 				<?isBytes>
@@ -1680,7 +1680,7 @@ std::string YulUtilFunctions::storageArrayPushZeroFunction(ArrayType const& _typ
 std::string YulUtilFunctions::partialClearStorageSlotFunction()
 {
 	std::string functionName = "partial_clear_storage_slot";
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createSharedFunction(functionName, [&]() {
 		return Whiskers(R"(
 		function <functionName>(slot, offset) {
 			let mask := <shr>(mul(8, sub(<wordSize>, offset)), <ones>)
@@ -1703,7 +1703,7 @@ std::string YulUtilFunctions::clearStorageRangeFunction(Type const& _type)
 	std::string functionName = "clear_storage_range_" + _type.identifier();
 
 	bool clearFullSlot = _type.storageBytes() < VMWordBytes;
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createSharedFunction(functionName, [&]() {
 		if (clearFullSlot)
 			return Whiskers(R"(
 				function <functionName>(start, end) {
@@ -1743,7 +1743,7 @@ std::string YulUtilFunctions::clearStorageArrayFunction(ArrayType const& _type)
 
 	std::string functionName = "clear_storage_array_" + _type.identifier();
 
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createSharedFunction(functionName, [&]() {
 		return Whiskers(R"(
 			function <functionName>(slot) {
 				<?dynamic>
@@ -1774,7 +1774,7 @@ std::string YulUtilFunctions::clearStorageStructFunction(StructType const& _type
 
 	std::string functionName = "clear_struct_storage_" + _type.identifier();
 
-	return m_functionCollector.createFunction(functionName, [&] {
+	return m_functionCollector.createSharedFunction(functionName, [&] {
 		MemberList::MemberMap structMembers = _type.nativeMembers(nullptr);
 		std::vector<std::map<std::string, std::string>> memberSetValues;
 
@@ -1839,7 +1839,7 @@ std::string YulUtilFunctions::copyArrayToStorageFunction(ArrayType const& _fromT
 	hypAssert(!_fromType.baseType()->isValueType());
 
 	std::string functionName = "copy_array_to_storage_from_" + _fromType.identifier() + "_to_" + _toType.identifier();
-	return m_functionCollector.createFunction(functionName, [&](){
+	return m_functionCollector.createSharedFunction(functionName, [&](){
 		Whiskers templ(R"(
 			function <functionName>(slot, value<?isFromDynamicCalldata>, len</isFromDynamicCalldata>) {
 				<?fromStorage> if eq(slot, value) { leave } </fromStorage>
@@ -1928,7 +1928,7 @@ std::string YulUtilFunctions::copyByteArrayToStorageFunction(ArrayType const& _f
 	hypAssert(_toType.isByteArrayOrString(), "");
 
 	std::string functionName = "copy_byte_array_to_storage_from_" + _fromType.identifier() + "_to_" + _toType.identifier();
-	return m_functionCollector.createFunction(functionName, [&](){
+	return m_functionCollector.createSharedFunction(functionName, [&](){
 		Whiskers templ(R"(
 			function <functionName>(slot, src<?fromCalldata>, len</fromCalldata>) {
 				<?fromStorage> if eq(slot, src) { leave } </fromStorage>
@@ -2011,7 +2011,7 @@ std::string YulUtilFunctions::copyValueArrayToStorageFunction(ArrayType const& _
 	hypAssert(_toType.storageStride() <= VMWordBytes, "");
 
 	std::string functionName = "copy_array_to_storage_from_" + _fromType.identifier() + "_to_" + _toType.identifier();
-	return m_functionCollector.createFunction(functionName, [&](){
+	return m_functionCollector.createSharedFunction(functionName, [&](){
 		if (
 			auto const* functionType = dynamic_cast<FunctionType const*>(_toType.baseType());
 			functionType && functionType->kind() == FunctionType::Kind::External
@@ -2218,7 +2218,7 @@ std::string YulUtilFunctions::copyValueArrayToStorageFunction(ArrayType const& _
 std::string YulUtilFunctions::arrayConvertLengthToSize(ArrayType const& _type)
 {
 	std::string functionName = "array_convert_length_to_size_" + _type.identifier();
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createSharedFunction(functionName, [&]() {
 		Type const& baseType = *_type.baseType();
 
 		switch (_type.location())
@@ -2272,7 +2272,7 @@ std::string YulUtilFunctions::arrayAllocationSizeFunction(ArrayType const& _type
 {
 	hypAssert(_type.dataStoredIn(DataLocation::Memory), "");
 	std::string functionName = "array_allocation_size_" + _type.identifier();
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createSharedFunction(functionName, [&]() {
 		Whiskers w(R"(
 			function <functionName>(length) -> size {
 				// Make sure we can allocate memory without overflow
@@ -2302,7 +2302,7 @@ std::string YulUtilFunctions::arrayAllocationSizeFunction(ArrayType const& _type
 std::string YulUtilFunctions::arrayDataAreaFunction(ArrayType const& _type)
 {
 	std::string functionName = "array_dataslot_" + _type.identifier();
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createSharedFunction(functionName, [&]() {
 		// No special processing for calldata arrays, because they are stored as
 		// offset of the data area and length on the stack, so the offset already
 		// points to the data area.
@@ -2334,7 +2334,7 @@ std::string YulUtilFunctions::arrayDataAreaFunction(ArrayType const& _type)
 std::string YulUtilFunctions::storageArrayIndexAccessFunction(ArrayType const& _type)
 {
 	std::string functionName = "storage_array_index_access_" + _type.identifier();
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createSharedFunction(functionName, [&]() {
 		return Whiskers(R"(
 			function <functionName>(array, index) -> slot, offset {
 				let arrayLength := <arrayLen>(array)
@@ -2381,7 +2381,7 @@ std::string YulUtilFunctions::storageArrayIndexAccessFunction(ArrayType const& _
 std::string YulUtilFunctions::memoryArrayIndexAccessFunction(ArrayType const& _type)
 {
 	std::string functionName = "memory_array_index_access_" + _type.identifier();
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createSharedFunction(functionName, [&]() {
 		return Whiskers(R"(
 			function <functionName>(baseRef, index) -> addr {
 				if iszero(lt(index, <arrayLen>(baseRef))) {
@@ -2409,7 +2409,7 @@ std::string YulUtilFunctions::calldataArrayIndexAccessFunction(ArrayType const&
 {
 	hypAssert(_type.dataStoredIn(DataLocation::CallData), "");
 	std::string functionName = "calldata_array_index_access_" + _type.identifier();
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createSharedFunction(functionName, [&]() {
 		return Whiskers(R"(
 			function <functionName>(base_ref<?dynamicallySized>, length</dynamicallySized>, index) -> addr<?dynamicallySizedBase>, len</dynamicallySizedBase> {
 				if iszero(lt(index, <?dynamicallySized>length<!dynamicallySized><arrayLen></dynamicallySized>)) { <panic>() }
@@ -2436,7 +2436,7 @@ std::string YulUtilFunctions::calldataArrayIndexRangeAccess(ArrayType const& _ty
 	hypAssert(_type.dataStoredIn(DataLocation::CallData), "");
 	hypAssert(_type.isDynamicallySized(), "");
 	std::string functionName = "calldata_array_index_range_access_" + _type.identifier();
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createSharedFunction(functionName, [&]() {
 		return Whiskers(R"(
 			function <functionName>(offset, length, startIndex, endIndex) -> offsetOut, lengthOut {
 				if gt(startIndex, endIndex) { <revertSliceStartAfterEnd>() }
@@ -2458,7 +2458,7 @@ std::string YulUtilFunctions::accessCalldataTailFunction(Type const& _type)
 	hypAssert(_type.isDynamicallyEncoded(), "");
 	hypAssert(_type.dataStoredIn(DataLocation::CallData), "");
 	std::string functionName = "access_calldata_tail_" + _type.identifier();
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createSharedFunction(functionName, [&]() {
 		return Whiskers(R"(
 			function <functionName>(base_ref, ptr_to_tail) -> addr<?dynamicallySized>, length</dynamicallySized> {
 				let rel_offset_of_tail := calldataload(ptr_to_tail)
@@ -2490,7 +2490,7 @@ std::string YulUtilFunctions::nextArrayElementFunction(ArrayType const& _type)
 	if (_type.dataStoredIn(DataLocation::Storage))
 		hypAssert(_type.baseType()->storageBytes() > (VMWordBytes / 2), "");
 	std::string functionName = "array_nextElement_" + _type.identifier();
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createSharedFunction(functionName, [&]() {
 		Whiskers templ(R"(
 			function <functionName>(ptr) -> next {
 				next := add(ptr, <advance>)
@@ -2531,7 +2531,7 @@ std::string YulUtilFunctions::copyArrayFromStorageToMemoryFunction(ArrayType con
 
 	std::string functionName = "copy_array_from_storage_to_memory_" + _from.identifier();
 
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createSharedFunction(functionName, [&]() {
 		if (_from.baseType()->isValueType())
 		{
 			hypAssert(*_from.baseType() == *_to.baseType(), "");
@@ -2625,7 +2625,7 @@ std::string YulUtilFunctions::bytesOrStringConcatFunction(
 		totalParams += argumentType->sizeOnStack();
 		functionName += "_" + argumentType->identifier();
 	}
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createSharedFunction(functionName, [&]() {
 		Whiskers templ(R"(
 			function <functionName>(<parameters>) -> outPtr {
 				outPtr := <allocateUnbounded>()
@@ -2654,7 +2654,7 @@ std::string YulUtilFunctions::bytesOrStringConcatFunction(
 std::string YulUtilFunctions::mappingIndexAccessFunction(MappingType const& _mappingType, Type const& _keyType)
 {
 	std::string functionName = "mapping_index_access_" + _mappingType.identifier() + "_of_" + _keyType.identifier();
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createSharedFunction(functionName, [&]() {
 		if (_mappingType.keyType()->isDynamicallySized())
 			return Whiskers(R"(
 				function <functionName>(slot <?+key>,</+key> <key>) -> dataSlot {
@@ -2713,7 +2713,7 @@ std::string YulUtilFunctions::readFromStorageDynamic(Type const& _type, bool _sp
 		std::string(_splitFunctionTypes ? "split_" : "") +
 		_type.identifier();
 
-	return m_functionCollector.createFunction(functionName, [&] {
+	return m_functionCollector.createSharedFunction(functionName, [&] {
 		return Whiskers(R"(
 			function <functionName>(slot, offset) -> value {
 				if gt(offset, 0) { <panic>() }
@@ -2741,7 +2741,7 @@ std::string YulUtilFunctions::readFromStorageValueType(Type const& _type, std::o
 			"_" +
 			_type.identifier();
 
-	return m_functionCollector.createFunction(functionName, [&] {
+	return m_functionCollector.createSharedFunction(functionName, [&] {
 		if (
 			auto const* funType = dynamic_cast<FunctionType const*>(&_type);
 			funType && funType->kind() == FunctionType::Kind::External
@@ -2816,7 +2816,7 @@ std::string YulUtilFunctions::readFromStorageReferenceType(Type const& _type)
 		.render();
 	}
 
-	return m_functionCollector.createFunction(functionName, [&] {
+	return m_functionCollector.createSharedFunction(functionName, [&] {
 		return Whiskers(R"(
 			function <functionName>(slot) -> value {
 				value := <allocStruct>()
@@ -2855,7 +2855,7 @@ std::string YulUtilFunctions::updateStorageValueFunction(
 		"_to_" +
 		_toType.identifier();
 
-	return m_functionCollector.createFunction(functionName, [&] {
+	return m_functionCollector.createSharedFunction(functionName, [&] {
 		if (_toType.isValueType())
 		{
 			hypAssert(_fromType.isImplicitlyConvertibleTo(_toType), "");
@@ -2984,7 +2984,7 @@ std::string YulUtilFunctions::writeToMemoryFunction(Type const& _type)
 {
 	std::string const functionName = "write_to_memory_" + _type.identifier();
 
-	return m_functionCollector.createFunction(functionName, [&] {
+	return m_functionCollector.createSharedFunction(functionName, [&] {
 		hypAssert(!dynamic_cast<StringLiteralType const*>(&_type), "");
 		if (auto ref = dynamic_cast<ReferenceType const*>(&_type))
 		{
@@ -3043,7 +3043,7 @@ std::string YulUtilFunctions::extractFromStorageValueDynamic(Type const& _type)
 	std::string functionName =
 		"extract_from_storage_value_dynamic" +
 		_type.identifier();
-	return m_functionCollector.createFunction(functionName, [&] {
+	return m_functionCollector.createSharedFunction(functionName, [&] {
 		return Whiskers(R"(
 			function <functionName>(slot_value, offset) -> value {
 				value := <cleanupStorage>(<shr>(mul(offset, 8), slot_value))
@@ -3059,7 +3059,7 @@ std::string YulUtilFunctions::extractFromStorageValueDynamic(Type const& _type)
 std::string YulUtilFunctions::extractFromStorageValue(Type const& _type, size_t _offset)
 {
 	std::string functionName = "extract_from_storage_value_offset_" + std::to_string(_offset) + _type.identifier();
-	return m_functionCollector.createFunction(functionName, [&] {
+	return m_functionCollector.createSharedFunction(functionName, [&] {
 		return Whiskers(R"(
 			function <functionName>(slot_value) -> value {
 				value := <cleanupStorage>(<shr>(slot_value))
@@ -3077,7 +3077,7 @@ std::string YulUtilFunctions::cleanupFromStorageFunction(Type const& _type)
 	hypAssert(_type.isValueType(), "");
 
 	std::string functionName = std::string("cleanup_from_storage_") + _type.identifier();
-	return m_functionCollector.createFunction(functionName, [&] {
+	return m_functionCollector.createSharedFunction(functionName, [&] {
 		Whiskers templ(R"(
 			function <functionName>(value) -> cleaned {
 				cleaned := <cleaned>
@@ -3110,7 +3110,7 @@ std::string YulUtilFunctions::cleanupFromStorageFunction(Type const& _type)
 std::string YulUtilFunctions::prepareStoreFunction(Type const& _type)
 {
 	std::string functionName = "prepare_store_" + _type.identifier();
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createSharedFunction(functionName, [&]() {
 		hypAssert(_type.isValueType(), "");
 		auto const* funType = dynamic_cast<FunctionType const*>(&_type);
 		if (funType && funType->kind() == FunctionType::Kind::External)
@@ -3145,7 +3145,7 @@ std::string YulUtilFunctions::prepareStoreFunction(Type const& _type)
 std::string YulUtilFunctions::allocationFunction()
 {
 	std::string functionName = "allocate_memory";
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createSharedFunction(functionName, [&]() {
 		return Whiskers(R"(
 			function <functionName>(size) -> memPtr {
 				memPtr := <allocateUnbounded>()
@@ -3162,7 +3162,7 @@ std::string YulUtilFunctions::allocationFunction()
 std::string YulUtilFunctions::allocateUnboundedFunction()
 {
 	std::string functionName = "allocate_unbounded";
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createSharedFunction(functionName, [&]() {
 		return Whiskers(R"(
 			function <functionName>() -> memPtr {
 				memPtr := mload(<freeMemoryPointer>)
@@ -3177,7 +3177,7 @@ std::string YulUtilFunctions::allocateUnboundedFunction()
 std::string YulUtilFunctions::finalizeAllocationFunction()
 {
 	std::string functionName = "finalize_allocation";
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createSharedFunction(functionName, [&]() {
 		return Whiskers(R"(
 			function <functionName>(memPtr, size) {
 				let newFreePtr := add(memPtr, <roundUp>(size))
@@ -3206,7 +3206,7 @@ std::string YulUtilFunctions::zeroMemoryFunction(Type const& _type)
 	hypAssert(_type.hasSimpleZeroValueInMemory(), "");
 
 	std::string functionName = "zero_memory_chunk_" + _type.identifier();
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createSharedFunction(functionName, [&]() {
 		return Whiskers(R"(
 			function <functionName>(dataStart, dataSizeInBytes) {
 				calldatacopy(dataStart, calldatasize(), dataSizeInBytes)
@@ -3222,7 +3222,7 @@ std::string YulUtilFunctions::zeroComplexMemoryArrayFunction(ArrayType const& _t
 	hypAssert(!_type.baseType()->hasSimpleZeroValueInMemory(), "");
 
 	std::string functionName = "zero_complex_memory_array_" + _type.identifier();
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createSharedFunction(functionName, [&]() {
 		return Whiskers(R"(
 			function <functionName>(dataStart, dataSizeInBytes) {
 				for {let i := 0} lt(i, dataSizeInBytes) { i := add(i, <stride>) } {
@@ -3243,7 +3243,7 @@ std::string YulUtilFunctions::zeroComplexMemoryArrayFunction(ArrayType const& _t
 std::string YulUtilFunctions::allocateMemoryArrayFunction(ArrayType const& _type)
 {
 	std::string functionName = "allocate_memory_array_" + _type.identifier();
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createSharedFunction(functionName, [&]() {
 		return Whiskers(R"(
 				function <functionName>(length) -> memPtr {
 					let allocSize := <allocSize>(length)
@@ -3264,7 +3264,7 @@ std::string YulUtilFunctions::allocateMemoryArrayFunction(ArrayType const& _type
 std::string YulUtilFunctions::allocateAndInitializeMemoryArrayFunction(ArrayType const& _type)
 {
 	std::string functionName = "allocate_and_zero_memory_array_" + _type.identifier();
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createSharedFunction(functionName, [&]() {
 		return Whiskers(R"(
 				function <functionName>(length) -> memPtr {
 					memPtr := <allocArray>(length)
@@ -3290,7 +3290,7 @@ std::string YulUtilFunctions::allocateAndInitializeMemoryArrayFunction(ArrayType
 std::string YulUtilFunctions::allocateMemoryStructFunction(StructType const& _type)
 {
 	std::string functionName = "allocate_memory_struct_" + _type.identifier();
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createSharedFunction(functionName, [&]() {
 		Whiskers templ(R"(
 		function <functionName>() -> memPtr {
 			memPtr := <alloc>(<allocSize>)
@@ -3307,7 +3307,7 @@ std::string YulUtilFunctions::allocateMemoryStructFunction(StructType const& _ty
 std::string YulUtilFunctions::allocateAndInitializeMemoryStructFunction(StructType const& _type)
 {
 	std::string functionName = "allocate_and_zero_memory_struct_" + _type.identifier();
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createSharedFunction(functionName, [&]() {
 		Whiskers templ(R"(
 		function <functionName>() -> memPtr {
 			memPtr := <allocStruct>()
@@ -3367,7 +3367,7 @@ std::string YulUtilFunctions::conversionFunction(Type const& _from, Type const&
 			_from.identifier() +
 			"_to_" +
 			_to.identifier();
-		return m_functionCollector.createFunction(functionName, [&]() {
+		return m_functionCollector.createSharedFunction(functionName, [&]() {
 			return Whiskers(R"(
 				function <functionName>(<?external>addr, </external>functionId) -> <?external>outAddr, </external>outFunctionId {
 					<?external>outAddr := addr</external>
@@ -3408,7 +3408,7 @@ std::string YulUtilFunctions::conversionFunction(Type const& _from, Type const&
 			_from.identifier() +
 			"_to_" +
 			_to.identifier();
-		return m_functionCollector.createFunction(functionName, [&]() {
+		return m_functionCollector.createSharedFunction(functionName, [&]() {
 			return Whiskers(R"(
 				function <functionName>(offset, length) -> outOffset, outLength {
 					outOffset := offset
@@ -3439,7 +3439,7 @@ std::string YulUtilFunctions::conversionFunction(Type const& _from, Type const&
 		_from.identifier() +
 		"_to_" +
 		_to.identifier();
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createSharedFunction(functionName, [&]() {
 		Whiskers templ(R"(
 			function <functionName>(value) -> converted {
 				<body>
@@ -3631,7 +3631,7 @@ std::string YulUtilFunctions::bytesToFixedBytesConversionFunction(ArrayType cons
 	hypAssert(_from.isByteArray(), "");
 	hypAssert(_from.isDynamicallySized(), "");
 	std::string functionName = "convert_bytes_to_fixedbytes_from_" + _from.identifier() + "_to_" + _to.identifier();
-	return m_functionCollector.createFunction(functionName, [&](auto& _args, auto& _returnParams) {
+	return m_functionCollector.createSharedFunction(functionName, [&](auto& _args, auto& _returnParams) {
 		_args = { "array" };
 		bool fromCalldata = _from.dataStoredIn(DataLocation::CallData);
 		if (fromCalldata)
@@ -3696,7 +3696,7 @@ std::string YulUtilFunctions::copyStructToStorageFunction(StructType const& _fro
 		"_to_" +
 		_to.identifier();
 
-	return m_functionCollector.createFunction(functionName, [&](auto& _arguments, auto&) {
+	return m_functionCollector.createSharedFunction(functionName, [&](auto& _arguments, auto&) {
 		_arguments = {"slot", "value"};
 		Whiskers templ(R"(
 			<?fromStorage> if iszero(eq(slot, value)) { </fromStorage>
@@ -3820,7 +3820,7 @@ std::string YulUtilFunctions::arrayConversionFunction(ArrayType const& _from, Ar
 		"_to_" +
 		_to.identifier();
 
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createSharedFunction(functionName, [&]() {
 		Whiskers templ(R"(
 			function <functionName>(value<?fromCalldataDynamic>, length</fromCalldataDynamic>) -> converted <?toCalldataDynamic>, outLength</toCalldataDynamic> {
 				<body>
@@ -3886,7 +3886,7 @@ std::string YulUtilFunctions::cleanupFunction(Type const& _type)
 		return cleanupFunction(userDefinedValueType->underlyingType());
 
 	std::string functionName = std::string("cleanup_") + _type.identifier();
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createSharedFunction(functionName, [&]() {
 		Whiskers templ(R"(
 			function <functionName>(value) -> cleaned {
 				<body>
@@ -3985,7 +3985,7 @@ std::string YulUtilFunctions::cleanupFunction(Type const& _type)
 std::string YulUtilFunctions::validatorFunction(Type const& _type, bool _revertOnFailure)
 {
 	std::string functionName = std::string("validator_") + (_revertOnFailure ? "revert_" : "assert_") + _type.identifier();
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createSharedFunction(functionName, [&]() {
 		Whiskers templ(R"(
 			function <functionName>(value) {
 				if iszero(<condition>) { <failure> }
@@ -4050,7 +4050,7 @@ std::string YulUtilFunctions::packedHashFunction(
 	size_t sizeOnStack = 0;
 	for (Type const* t: _givenTypes)
 		sizeOnStack += t->sizeOnStack();
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createSharedFunction(functionName, [&]() {
 		Whiskers templ(R"(
 			function <functionName>(<variables>) -> hash {
 				let pos := <allocateUnbounded>()
@@ -4071,7 +4071,7 @@ std::string YulUtilFunctions::packedHashFunction(
 std::string YulUtilFunctions::forwardingRevertFunction()
 {
 	std::string functionName = "revert_forward_" + std::to_string(true);
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createSharedFunction(functionName, [&]() {
 		return Whiskers(R"(
 			function <functionName>() {
 				let pos := <allocateUnbounded>()
@@ -4092,7 +4092,7 @@ std::string YulUtilFunctions::decrementCheckedFunction(Type const& _type)
 
 	std::string const functionName = "decrement_" + _type.identifier();
 
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createSharedFunction(functionName, [&]() {
 		return Whiskers(R"(
 			function <functionName>(value) -> ret {
 				value := <cleanupFunction>(value)
@@ -4115,7 +4115,7 @@ std::string YulUtilFunctions::decrementWrappingFunction(Type const& _type)
 
 	std::string const functionName = "decrement_wrapping_" + _type.identifier();
 
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createSharedFunction(functionName, [&]() {
 		return Whiskers(R"(
 			function <functionName>(value) -> ret {
 				ret := <cleanupFunction>(sub(value, 1))
@@ -4134,7 +4134,7 @@ std::string YulUtilFunctions::incrementCheckedFunction(Type const& _type)
 
 	std::string const functionName = "increment_" + _type.identifier();
 
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createSharedFunction(functionName, [&]() {
 		return Whiskers(R"(
 			function <functionName>(value) -> ret {
 				value := <cleanupFunction>(value)
@@ -4157,7 +4157,7 @@ std::string YulUtilFunctions::incrementWrappingFunction(Type const& _type)
 
 	std::string const functionName = "increment_wrapping_" + _type.identifier();
 
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createSharedFunction(functionName, [&]() {
 		return Whiskers(R"(
 			function <functionName>(value) -> ret {
 				ret := <cleanupFunction>(add(value, 1))
@@ -4176,7 +4176,7 @@ std::string YulUtilFunctions::negateNumberCheckedFunction(Type const& _type)
 	hypAssert(type.isSigned(), "Expected signed type!");
 
 	std::string const functionName = "negate_" + _type.identifier();
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createSharedFunction(functionName, [&]() {
 		return Whiskers(R"(
 			function <functionName>(value) -> ret {
 				value := <cleanupFunction>(value)
@@ -4199,7 +4199,7 @@ std::string YulUtilFunctions::negateNumberWrappingFunction(Type const& _type)
 	hypAssert(type.isSigned(), "Expected signed type!");
 
 	std::string const functionName = "negate_wrapping_" + _type.identifier();
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createSharedFunction(functionName, [&]() {
 		return Whiskers(R"(
 			function <functionName>(value) -> ret {
 				ret := <cleanupFunction>(sub(0, value))
@@ -4217,7 +4217,7 @@ std::string YulUtilFunctions::zeroValueFunction(Type const& _type, bool _splitFu
 
 	std::string const functionName = "zero_value_for_" + std::string(_splitFunctionTypes ? "split_" : "") + _type.identifier();
 
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createSharedFunction(functionName, [&]() {
 		FunctionType const* fType = dynamic_cast<FunctionType const*>(&_type);
 		if (fType && fType->kind() == FunctionType::Kind::External && _splitFunctionTypes)
 			return Whiskers(R"(
@@ -4290,7 +4290,7 @@ std::string YulUtilFunctions::storageSetToZeroFunction(Type const& _type)
 {
 	std::string const functionName = "storage_set_to_zero_" + _type.identifier();
 
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createSharedFunction(functionName, [&]() {
 		if (_type.isValueType())
 			return Whiskers(R"(
 				function <functionName>(slot, offset) {
@@ -4337,7 +4337,7 @@ std::string YulUtilFunctions::conversionFunctionSpecial(Type const& _from, Type
 		_from.identifier() +
 		"_to_" +
 		_to.identifier();
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createSharedFunction(functionName, [&]() {
 		if (
 			auto fromTuple = dynamic_cast<TupleType const*>(&_from), toTuple = dynamic_cast<TupleType const*>(&_to);
 			fromTuple && toTuple && fromTuple->components().size() == toTuple->components().size()
@@ -4431,7 +4431,7 @@ std::string YulUtilFunctions::readFromMemoryOrCalldata(Type const& _type, bool _
 	if (_fromCalldata)
 		hypAssert(!_type.isDynamicallyEncoded(), "");
 
-	return m_functionCollector.createFunction(functionName, [&] {
+	return m_functionCollector.createSharedFunction(functionName, [&] {
 		if (auto refType = dynamic_cast<ReferenceType const*>(&_type))
 		{
 			hypAssert(refType->sizeOnStack() == 1, "");
@@ -4488,7 +4488,7 @@ std::string YulUtilFunctions::readFromMemoryOrCalldata(Type const& _type, bool _
 std::string YulUtilFunctions::revertReasonIfDebugFunction(std::string const& _message)
 {
 	std::string functionName = "revert_error_" + util::toHex(util::keccak256(_message).asBytes());
-	return m_functionCollector.createFunction(functionName, [&](auto&, auto&) -> std::string {
+	return m_functionCollector.createSharedFunction(functionName, [&](auto&, auto&) -> std::string {
 		return revertReasonIfDebugBody(m_revertStrings, allocateUnboundedFunction() + "()", _message);
 	});
 }
@@ -4518,8 +4518,7 @@ std::string YulUtilFunctions::revertReasonIfDebugBody(
 	)");
 	templ("allocate", _allocation);
 	// Shift selector to top of VM word (selector << (VMWordBits - 32)).
-	// selectorFromSignatureU256 returns sel << 224, shift by VMWordBits - 256 more.
-	templ("sig", toCompactHexWithPrefix(u512(bigint(util::selectorFromSignatureU32("Error(string)")) << (VMWordBits - 32))));
+	templ("sig", toCompactHexWithPrefix(u512(bigint(util::c_errorStringSelector) << (VMWordBits - 32))));
 	templ("length", std::to_string(_message.length()));
 	templ("wordSizeHex", toCompactHexWithPrefix(u256(VMWordBytes)));
 
@@ -4546,9 +4545,9 @@ std::string YulUtilFunctions::revertReasonIfDebugBody(
 std::string YulUtilFunctions::panicFunction(util::PanicCode _code)
 {
 	std::string functionName = "panic_error_" + toCompactHexWithPrefix(uint64_t(_code));
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createSharedFunction(functionName, [&]() {
 		// Panic(uint256) ABI: selector (4 bytes) + code (64 bytes) = 68 bytes (0x44).
-		// selectorFromSignatureU256 returns sel << 224 (top of u256). Shift further to top of VM word.
+		// The selector is left-aligned in a u256. Shift further to top of VM word.
 		return Whiskers(R"(
 			function <functionName>() {
 				mstore(0, <shlExtra>(<selector>))
@@ -4558,7 +4557,7 @@ std::string YulUtilFunctions::panicFunction(util::PanicCode _code)
 		)")
 		("functionName", functionName)
 		("shlExtra", shiftLeftFunction(VMWordBits - 256))
-		("selector", util::selectorFromSignatureU256("Panic(uint256)").str())
+		("selector", (u256(util::c_panicSelector) << (256 - 32)).str())
 		("code", toCompactHexWithPrefix(static_cast<unsigned>(_code)))
 		.render();
 	});
@@ -4568,7 +4567,7 @@ std::string YulUtilFunctions::returnDataSelectorFunction()
 {
 	std::string const functionName = "return_data_selector";
 
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createSharedFunction(functionName, [&]() {
 		return util::Whiskers(R"(
 			function <functionName>() -> sig {
 				if gt(returndatasize(), 3) {
@@ -4587,7 +4586,7 @@ std::string YulUtilFunctions::tryDecodeErrorMessageFunction()
 {
 	std::string const functionName = "try_decode_error_message";
 
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createSharedFunction(functionName, [&]() {
 		return util::Whiskers(R"(
 			function <functionName>() -> ret {
 				if lt(returndatasize(), 0x44) { leave }
@@ -4626,7 +4625,7 @@ std::string YulUtilFunctions::tryDecodePanicDataFunction()
 {
 	std::string const functionName = "try_decode_panic_data";
 
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createSharedFunction(functionName, [&]() {
 		return util::Whiskers(R"(
 			function <functionName>() -> success, data {
 				if gt(returndatasize(), 0x23) {
@@ -4646,7 +4645,7 @@ std::string YulUtilFunctions::extractReturndataFunction()
 {
 	std::string const functionName = "extract_returndata";
 
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createSharedFunction(functionName, [&]() {
 		return util::Whiskers(R"(
 			function <functionName>() -> data {
 				switch returndatasize()
@@ -4679,7 +4678,7 @@ std::string YulUtilFunctions::copyConstructorArgumentsToMemoryFunction(
 		"_" +
 		toString(_contract.id());
 
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createSharedFunction(functionName, [&]() {
 		std::string returnParams = suffixedVariableNameList("ret_param_",0, CompilerUtils::sizeOnStack(_contract.constructor()->parameters()));
 		ABIFunctions abiFunctions(m_qrvmVersion, m_revertStrings, m_functionCollector);
 
@@ -4707,7 +4706,7 @@ std::string YulUtilFunctions::externalCodeFunction()
 {
 	std::string functionName = "external_code_at";
 
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createSharedFunction(functionName, [&]() {
 		return util::Whiskers(R"(
 			function <functionName>(addr) -> mpos {
 				let length := extcodesize(addr)
@@ -4725,7 +4724,7 @@ std::string YulUtilFunctions::externalCodeFunction()
 std::string YulUtilFunctions::externalFunctionPointersEqualFunction()
 {
 	std::string const functionName = "externalFunctionPointersEqualFunction";
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createSharedFunction(functionName, [&]() {
 		return util::Whiskers(R"(
 			function <functionName>(
 				leftAddress,
@@ -61,12 +61,14 @@ public:
 		RevertStrings _revertStrings,
 		std::map<std::string, unsigned> _sourceIndices,
 		langutil::DebugInfoSelection const& _debugInfoSelection,
-		langutil::CharStreamProvider const* _hyperionSourceProvider
+		langutil::CharStreamProvider const* _hyperionSourceProvider,
+		std::shared_ptr<SharedYulFunctionCache> _sharedFunctions = nullptr
 	):
 		m_qrvmVersion(_qrvmVersion),
 		m_executionContext(_executionContext),
 		m_revertStrings(_revertStrings),
 		m_sourceIndices(std::move(_sourceIndices)),
+		m_functions(std::move(_sharedFunctions)),
 		m_debugInfoSelection(_debugInfoSelection),
 		m_hyperionSourceProvider(_hyperionSourceProvider)
 	{}
@@ -1096,7 +1096,8 @@ void IRGenerator::resetContext(ContractDefinition const& _contract, ExecutionCon
 		m_context.revertStrings(),
 		m_context.sourceIndices(),
 		m_context.debugInfoSelection(),
-		m_context.hyperionSourceProvider()
+		m_context.hyperionSourceProvider(),
+		m_context.functionCollector().sharedFunctions()
 	);
 	m_context = std::move(newContext);
 
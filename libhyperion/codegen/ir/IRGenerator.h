@@ -52,7 +52,8 @@ public:
 		std::map<std::string, unsigned> _sourceIndices,
 		langutil::DebugInfoSelection const& _debugInfoSelection,
 		langutil::CharStreamProvider const* _hyperionSourceProvider,
-		OptimiserSettings& _optimiserSettings
+		OptimiserSettings& _optimiserSettings,
+		std::shared_ptr<SharedYulFunctionCache> _sharedFunctions = nullptr
 	):
 		m_qrvmVersion(_qrvmVersion),
 		m_context(
@@ -61,7 +62,8 @@ public:
 			_revertStrings,
 			std::move(_sourceIndices),
 			_debugInfoSelection,
-			_hyperionSourceProvider
+			_hyperionSourceProvider,
+			std::move(_sharedFunctions)
 		),
 		m_utils(_qrvmVersion, m_context.revertStrings(), m_context.functionCollector()),
 		m_optimiserSettings(_optimiserSettings)
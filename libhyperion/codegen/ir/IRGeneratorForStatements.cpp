@@ -3233,7 +3233,7 @@ void IRGeneratorForStatements::handleCatch(TryStatement const& _tryStatement)
 
 	if (TryCatchClause const* errorClause = _tryStatement.errorClause())
 	{
-		appendCode() << "case " << selectorFromSignatureU32("Error(string)") << " {\n";
+		appendCode() << "case " << c_errorStringSelector << " {\n";
 		setLocation(*errorClause);
 		std::string const dataVariable = m_context.newYulVariable();
 		appendCode() << "let " << dataVariable << " := " << m_utils.tryDecodeErrorMessageFunction() << "()\n";
@@ -3253,7 +3253,7 @@ void IRGeneratorForStatements::handleCatch(TryStatement const& _tryStatement)
 	}
 	if (TryCatchClause const* panicClause = _tryStatement.panicClause())
 	{
-		appendCode() << "case " << selectorFromSignatureU32("Panic(uint256)") << " {\n";
+		appendCode() << "case " << c_panicSelector << " {\n";
 		setLocation(*panicClause);
 		std::string const success = m_context.newYulVariable();
 		std::string const code = m_context.newYulVariable();
@@ -86,6 +86,7 @@
 
 #include <boost/algorithm/string/replace.hpp>
 
+#include <range/v3/range/conversion.hpp>
 #include <range/v3/view/concat.hpp>
 #include <range/v3/view/map.hpp>
 
@@ -234,6 +235,14 @@ void CompilerStack::setQRVMVersion(langutil::QRVMVersion _version)
 	m_qrvmVersion = _version;
 }
 
+void CompilerStack::setParserThreadCount(size_t _threadCount)
+{
+	if (m_stackState >= ParsedAndImported)
+		hypThrow(CompilerError, "Must set parser thread count before parsing.");
+	hypAssert(_threadCount > 0);
+	m_parserThreadCount = _threadCount;
+}
+
 void CompilerStack::setModelCheckerSettings(ModelCheckerSettings _settings)
 {
 	if (m_stackState >= ParsedAndImported)
@@ -291,6 +300,11 @@ void CompilerStack::selectDebugInfo(DebugInfoSelection _debugInfoSelection)
 	m_debugInfoSelection = _debugInfoSelection;
 }
 
+void CompilerStack::setPersistentOptimizedCodeCache(std::shared_ptr<yul::PersistentOptimizedCodeCache> _cache)
+{
+	m_persistentOptimizedCodeCache = std::move(_cache);
+}
+
 void CompilerStack::addSMTLib2Response(h256 const& _hash, std::string const& _response)
 {
 	if (m_stackState >= ParsedAndImported)
@@ -310,6 +324,7 @@ void CompilerStack::reset(bool _keepSettings)
 		m_libraries.clear();
 		m_viaIR = false;
 		m_qrvmVersion = langutil::QRVMVersion();
+		m_parserThreadCount = util::availableThreadCount();
 		m_modelCheckerSettings = ModelCheckerSettings{};
 		m_generateIR = false;
 		m_revertStrings = RevertStrings::Default;
@@ -323,6 +338,8 @@ void CompilerStack::reset(bool _keepSettings)
 	m_globalContext.reset();
 	m_sourceOrder.clear();
 	m_contracts.clear();
+	m_optimizedCodeCache.reset();
+	m_sharedYulFunctions.reset();
 	m_errorReporter.clear();
 	TypeProvider::reset();
 }
@@ -333,7 +350,7 @@ void CompilerStack::setSources(StringMap _sources)
 		hypThrow(CompilerError, "Cannot change sources once set.");
 	if (m_stackState != Empty)
 		hypThrow(CompilerError, "Must set sources before parsing.");
-	for (auto source: _sources)
+	for (auto& source: _sources)
 		m_sources[source.first].charStream = std::make_unique<CharStream>(/*content*/std::move(source.second), /*name*/source.first);
 	m_stackState = SourcesSet;
 }
@@ -347,54 +364,91 @@ bool CompilerStack::parse()
 	if (SemVerVersion{std::string(VersionString)}.isPrerelease())
 		m_errorReporter.warning(3805_error, "This is a pre-release compiler version, please do not use it in production.");
 
-	Parser parser{m_errorReporter, m_qrvmVersion};
-
 	std::vector<std::string> sourcesToParse;
 	for (auto const& s: m_sources)
 		sourcesToParse.push_back(s.first);
 
-	for (size_t i = 0; i < sourcesToParse.size(); ++i)
+	// Sources are parsed in waves: all sources known at the start of a wave are parsed
+	// concurrently, then the results are taken over one by one in the order in which the
+	// sources were discovered, which is also where the imports of the next wave are found.
+	// Node IDs are shifted while taking over a result, so that they match a sequential parse.
+	int64_t lastNodeID = 0;
+	for (size_t waveStart = 0; waveStart < sourcesToParse.size();)
 	{
-		std::string const& path = sourcesToParse[i];
-		Source& source = m_sources[path];
-		source.ast = parser.parse(*source.charStream);
-		if (!source.ast)
-			hypAssert(Error::containsErrors(m_errorReporter.errors()), "Parser returned null but did not report error.");
-		else
+		size_t const waveEnd = sourcesToParse.size();
+		std::map<std::string, size_t> lastOccurrence;
+		for (size_t i = waveStart; i < waveEnd; ++i)
+			lastOccurrence[sourcesToParse[i]] = i;
+		std::map<std::string, ParsedSource> parsedSources = parseConcurrently(
+			lastOccurrence | ranges::views::keys | ranges::to<std::vector>
+		);
+
+		for (size_t i = waveStart; i < waveEnd; ++i)
 		{
-			source.ast->annotation().path = path;
+			std::string const path = sourcesToParse[i];
+			Source& source = m_sources[path];
+
+			// A result is only taken over if parsing did not produce any diagnostics, since
+			// their order and limits depend on everything reported so far. Everything else is
+			// parsed again in place.
+			auto parsed = parsedSources.find(path);
+			if (
+				parsed != parsedSources.end() &&
+				parsed->second.successful &&
+				parsed->second.charStream == source.charStream
+			)
+			{
+				source.ast = parsed->second.ast;
+				if (lastOccurrence.at(path) == i)
+					ASTNode::shiftIDs(parsed->second.nodes, lastNodeID);
+				lastNodeID += parsed->second.lastNodeID;
+			}
+			else
+			{
+				Parser parser{m_errorReporter, m_qrvmVersion, lastNodeID};
+				source.ast = parser.parse(*source.charStream);
+				lastNodeID = parser.lastNodeID();
+			}
 
-			for (auto const& import: ASTNode::filteredNodes<ImportDirective>(source.ast->nodes()))
+			if (!source.ast)
+				hypAssert(Error::containsErrors(m_errorReporter.errors()), "Parser returned null but did not report error.");
+			else
 			{
-				hypAssert(!import->path().empty(), "Import path cannot be empty.");
-				// Check whether the import directive is for the standard library,
-				// and if yes, add specified file to source units to be parsed.
-				auto it = stdlib::sources.find(import->path());
-				if (it != stdlib::sources.end())
+				source.ast->annotation().path = path;
+
+				for (auto const& import: ASTNode::filteredNodes<ImportDirective>(source.ast->nodes()))
 				{
-					auto [name, content] = *it;
-					m_sources[name].charStream = std::make_unique<CharStream>(content, name);
-					sourcesToParse.push_back(name);
+					hypAssert(!import->path().empty(), "Import path cannot be empty.");
+					// Check whether the import directive is for the standard library,
+					// and if yes, add specified file to source units to be parsed.
+					auto it = stdlib::sources.find(import->path());
+					if (it != stdlib::sources.end())
+					{
+						auto [name, content] = *it;
+						m_sources[name].charStream = std::make_unique<CharStream>(content, name);
+						sourcesToParse.push_back(name);
+					}
+
+					// The current value of `path` is the absolute path as seen from this source file.
+					// We first have to apply remappings before we can store the actual absolute path
+					// as seen globally.
+					import->annotation().absolutePath = applyRemapping(util::absolutePath(
+						import->path(),
+						path
+					), path);
 				}
 
-				// The current value of `path` is the absolute path as seen from this source file.
-				// We first have to apply remappings before we can store the actual absolute path
-				// as seen globally.
-				import->annotation().absolutePath = applyRemapping(util::absolutePath(
-					import->path(),
-					path
-				), path);
+				if (m_stopAfter >= ParsedAndImported)
+					for (auto const& newSource: loadMissingSources(*source.ast))
+					{
+						std::string const& newPath = newSource.first;
+						std::string const& newContents = newSource.second;
+						m_sources[newPath].charStream = std::make_shared<CharStream>(newContents, newPath);
+						sourcesToParse.push_back(newPath);
+					}
 			}
-
-			if (m_stopAfter >= ParsedAndImported)
-				for (auto const& newSource: loadMissingSources(*source.ast))
-				{
-					std::string const& newPath = newSource.first;
-					std::string const& newContents = newSource.second;
-					m_sources[newPath].charStream = std::make_shared<CharStream>(newContents, newPath);
-					sourcesToParse.push_back(newPath);
-				}
 		}
+		waveStart = waveEnd;
 	}
 
 	if (Error::containsErrors(m_errorReporter.errors()))
@@ -405,6 +459,46 @@ bool CompilerStack::parse()
 	return true;
 }
 
+std::map<std::string, CompilerStack::ParsedSource> CompilerStack::parseConcurrently(
+	std::vector<std::string> const& _paths
+) const
+{
+	std::vector<std::string> paths;
+	for (std::string const& path: _paths)
+		if (m_sources.at(path).charStream->source().find("assembly") == std::string::npos)
+			paths.push_back(path);
+
+	if (std::min(paths.size(), m_parserThreadCount) <= 1)
+		return {};
+
+	std::vector<ParsedSource> results(paths.size());
+	util::forEachIndexConcurrently(paths.size(), m_parserThreadCount, [&](size_t _index) {
+		ParsedSource& result = results[_index];
+		result.charStream = m_sources.at(paths[_index]).charStream;
+		try
+		{
+			ErrorList errors;
+			ErrorReporter errorReporter{errors};
+			Parser parser{errorReporter, m_qrvmVersion};
+			parser.recordCreatedNodes();
+			result.ast = parser.parse(*result.charStream);
+			result.lastNodeID = parser.lastNodeID();
+			result.nodes = parser.createdNodes();
+			result.successful = result.ast && errors.empty();
+		}
+		catch (...)
+		{
+			// Reported when the source is parsed again on the calling thread.
+			result.successful = false;
+		}
+	});
+
+	std::map<std::string, ParsedSource> parsedSources;
+	for (size_t i = 0; i < paths.size(); ++i)
+		parsedSources[paths[i]] = std::move(results[i]);
+	return parsedSources;
+}
+
 void CompilerStack::importASTs(std::map<std::string, Json::Value> const& _sources)
 {
 	if (m_stackState != Empty)
@@ -593,7 +687,7 @@ bool CompilerStack::analyzeLegacy(bool _noErrorsSoFar)
 			ControlFlowRevertPruner pruner(cfg);
 			pruner.run();
 
-			ControlFlowAnalyzer controlFlowAnalyzer(cfg, m_errorReporter);
+			ControlFlowAnalyzer controlFlowAnalyzer(cfg, m_errorReporter, m_parserThreadCount);
 			if (!controlFlowAnalyzer.run())
 				noErrors = false;
 		}
@@ -704,6 +798,8 @@ bool CompilerStack::compile(State _stopAfter)
 
 	// Only compile contracts individually which have been requested.
 	std::map<ContractDefinition const*, std::shared_ptr<Compiler const>> otherCompilers;
+	// The optimized code is only reused by contracts generated in this loop.
+	ScopeGuard releaseOptimizedCodeCache([&]() { m_optimizedCodeCache.reset(); });
 
 	for (Source const* source: m_sourceOrder)
 		for (ASTPointer<ASTNode> const& node: source->ast->nodes())
@@ -922,7 +1018,26 @@ Json::Value const& CompilerStack::yulIRAst(std::string const& _contractName) con
 	if (m_stackState != CompilationSuccessful)
 		hypThrow(CompilerError, "Compilation was not successful.");
 
-	return contract(_contractName).yulIRAst;
+	return yulIRAst(contract(_contractName));
+}
+
+Json::Value const& CompilerStack::yulIRAst(Contract const& _contract) const
+{
+	return _contract.yulIRAst.init([&]{
+		if (_contract.yulIR.empty())
+			return Json::Value{};
+
+		// Only the optimized object is kept, but parsing the IR again yields the unoptimized one.
+		yul::YulStack stack(
+			m_qrvmVersion,
+			yul::YulStack::Language::StrictAssembly,
+			m_optimiserSettings,
+			m_debugInfoSelection
+		);
+		bool analysisSuccessful = stack.parseAndAnalyze("", _contract.yulIR);
+		hypAssert(analysisSuccessful);
+		return stack.astJson();
+	});
 }
 
 std::string const& CompilerStack::yulIROptimized(std::string const& _contractName) const
@@ -930,7 +1045,18 @@ std::string const& CompilerStack::yulIROptimized(std::string const& _contractNam
 	if (m_stackState != CompilationSuccessful)
 		hypThrow(CompilerError, "Compilation was not successful.");
 
-	return contract(_contractName).yulIROptimized;
+	return yulIROptimized(contract(_contractName));
+}
+
+std::string const& CompilerStack::yulIROptimized(Contract const& _contract) const
+{
+	return _contract.yulIROptimized.init([&]{
+		hypAssert(
+			_contract.yulIROptimizedStack || _contract.yulIR.empty(),
+			"Optimized IR was released after code generation. IR generation has to be enabled to request it."
+		);
+		return _contract.yulIROptimizedStack ? _contract.yulIROptimizedStack->print(this) : std::string{};
+	});
 }
 
 Json::Value const& CompilerStack::yulIROptimizedAst(std::string const& _contractName) const
@@ -938,7 +1064,18 @@ Json::Value const& CompilerStack::yulIROptimizedAst(std::string const& _contract
 	if (m_stackState != CompilationSuccessful)
 		hypThrow(CompilerError, "Compilation was not successful.");
 
-	return contract(_contractName).yulIROptimizedAst;
+	return yulIROptimizedAst(contract(_contractName));
+}
+
+Json::Value const& CompilerStack::yulIROptimizedAst(Contract const& _contract) const
+{
+	return _contract.yulIROptimizedAst.init([&]{
+		hypAssert(
+			_contract.yulIROptimizedStack || _contract.yulIR.empty(),
+			"Optimized IR was released after code generation. IR generation has to be enabled to request it."
+		);
+		return _contract.yulIROptimizedStack ? _contract.yulIROptimizedStack->astJson() : Json::Value{};
+	});
 }
 
 qrvmasm::LinkerObject const& CompilerStack::object(std::string const& _contractName) const
@@ -1481,13 +1618,17 @@ void CompilerStack::generateIR(ContractDefinition const& _contract)
 	for (auto const& pair: m_contracts)
 		otherYulSources.emplace(pair.second.contract, pair.second.yulIR);
 
+	// The QRVM version and the revert strings setting cannot change before the next reset().
+	if (!m_sharedYulFunctions)
+		m_sharedYulFunctions = std::make_shared<SharedYulFunctionCache>();
 	IRGenerator generator(
 		m_qrvmVersion,
 		m_revertStrings,
 		sourceIndices(),
 		m_debugInfoSelection,
 		this,
-		m_optimiserSettings
+		m_optimiserSettings,
+		m_sharedYulFunctions
 	);
 	compiledContract.yulIR = generator.run(
 		_contract,
@@ -1495,24 +1636,29 @@ void CompilerStack::generateIR(ContractDefinition const& _contract)
 		otherYulSources
 	);
 
-	yul::YulStack stack(
+	if (!m_optimizedCodeCache)
+	{
+		m_optimizedCodeCache = std::make_shared<yul::OptimizedCodeCache>();
+		m_optimizedCodeCache->persistent = m_persistentOptimizedCodeCache;
+	}
+	auto stack = std::make_shared<yul::YulStack>(
 		m_qrvmVersion,
 		yul::YulStack::Language::StrictAssembly,
 		m_optimiserSettings,
-		m_debugInfoSelection
+		m_debugInfoSelection,
+		m_optimizedCodeCache
 	);
-	bool yulAnalysisSuccessful = stack.parseAndAnalyze("", compiledContract.yulIR);
+	bool yulAnalysisSuccessful = stack->parseAndAnalyze("", compiledContract.yulIR);
 	hypAssert(
 		yulAnalysisSuccessful,
 		compiledContract.yulIR + "\n\n"
 		"Invalid IR generated:\n" +
-		langutil::SourceReferenceFormatter::formatErrorInformation(stack.errors(), stack) + "\n"
+		langutil::SourceReferenceFormatter::formatErrorInformation(stack->errors(), *stack) + "\n"
 	);
 
-	compiledContract.yulIRAst = stack.astJson();
-	stack.optimize();
-	compiledContract.yulIROptimized = stack.print(this);
-	compiledContract.yulIROptimizedAst = stack.astJson();
+	stack->optimize();
+	// The printed IR and the JSON ASTs are only generated when requested.
+	compiledContract.yulIROptimizedStack = std::move(stack);
 }
 
 void CompilerStack::generateQRVMFromIR(ContractDefinition const& _contract)
@@ -1523,26 +1669,37 @@ void CompilerStack::generateQRVMFromIR(ContractDefinition const& _contract)
 		return;
 
 	Contract& compiledContract = m_contracts.at(_contract.fullyQualifiedName());
-	hypAssert(!compiledContract.yulIROptimized.empty(), "");
 	if (!compiledContract.object.bytecode.empty())
 		return;
+	hypAssert(compiledContract.yulIROptimizedStack, "");
 
-	// Re-parse the Yul IR in QRVM dialect
-	yul::YulStack stack(
-		m_qrvmVersion,
-		yul::YulStack::Language::StrictAssembly,
-		m_optimiserSettings,
-		m_debugInfoSelection
-	);
-	bool analysisSuccessful = stack.parseAndAnalyze("", compiledContract.yulIROptimized);
-	hypAssert(analysisSuccessful);
-
-	//cout << yul::AsmPrinter{}(*stack.parserResult()->code) << endl;
+	// With all debug info selected, the printed code carries all the debug data of the
+	// optimized object and parsing it again would only reproduce what is already in memory.
+	// Otherwise the code generator has to see the object as it was printed.
+	std::shared_ptr<yul::YulStack const> stack = compiledContract.yulIROptimizedStack;
+	if (m_debugInfoSelection != DebugInfoSelection::All())
+	{
+		// Re-parse the Yul IR in QRVM dialect
+		auto reparsedStack = std::make_shared<yul::YulStack>(
+			m_qrvmVersion,
+			yul::YulStack::Language::StrictAssembly,
+			m_optimiserSettings,
+			m_debugInfoSelection
+		);
+		bool analysisSuccessful = reparsedStack->parseAndAnalyze("", yulIROptimized(compiledContract));
+		hypAssert(analysisSuccessful);
+		stack = std::move(reparsedStack);
+	}
 
 	std::string deployedName = IRNames::deployedObject(_contract);
 	hypAssert(!deployedName.empty(), "");
-	tie(compiledContract.qrvmAssembly, compiledContract.qrvmRuntimeAssembly) = stack.assembleQRVMWithDeployed(deployedName);
+	tie(compiledContract.qrvmAssembly, compiledContract.qrvmRuntimeAssembly) = stack->assembleQRVMWithDeployed(deployedName);
 	assembleYul(_contract, compiledContract.qrvmAssembly, compiledContract.qrvmRuntimeAssembly);
+
+	// Apart from code generation, the optimized object is only needed for the IR outputs.
+	// Do not keep it alive for the lifetime of the compiler stack if none of them can be requested.
+	if (!m_generateIR)
+		compiledContract.yulIROptimizedStack.reset();
 }
 
 CompilerStack::Contract const& CompilerStack::contract(std::string const& _contractName) const
@@ -1658,6 +1815,8 @@ std::string CompilerStack::createMetadata(Contract const& _contract, bool _forIR
 			details["yulDetails"] = Json::objectValue;
 			details["yulDetails"]["stackAllocation"] = m_optimiserSettings.optimizeStackAllocation;
 			details["yulDetails"]["optimizerSteps"] = m_optimiserSettings.yulOptimiserSteps + ":" + m_optimiserSettings.yulOptimiserCleanupSteps;
+			if (m_optimiserSettings.yulOptimiserMinRoundGain > 0)
+				details["yulDetails"]["minRoundGain"] = Json::UInt(m_optimiserSettings.yulOptimiserMinRoundGain);
 		}
 		else if (
 			OptimiserSuite::isEmptyOptimizerSequence(m_optimiserSettings.yulOptimiserSteps) &&
@@ -45,6 +45,7 @@
 #include <libqrvmasm/LinkerObject.h>
 
 #include <libhyputil/Common.h>
+#include <libhyputil/Concurrency.h>
 #include <libhyputil/FixedHash.h>
 #include <libhyputil/LazyInit.h>
 
@@ -70,6 +71,13 @@ class AssemblyItem;
 using AssemblyItems = std::vector<AssemblyItem>;
 }
 
+namespace hyperion::yul
+{
+class YulStack;
+struct OptimizedCodeCache;
+struct PersistentOptimizedCodeCache;
+}
+
 namespace hyperion::frontend
 {
 
@@ -82,6 +90,7 @@ class Compiler;
 class GlobalContext;
 class Natspec;
 class DeclarationContainer;
+struct SharedYulFunctionCache;
 namespace experimental
 {
 class Analysis;
@@ -177,6 +186,12 @@ public:
 	/// Set model checker settings.
 	void setModelCheckerSettings(ModelCheckerSettings _settings);
 
+	/// Sets the maximum number of threads used to parse sources and to analyze the control flow
+	/// of functions, including the calling thread.
+	/// Defaults to the number of hardware threads.
+	/// Must be set before parsing.
+	void setParserThreadCount(size_t _threadCount);
+
 	/// Sets the requested contract names by source.
 	/// If empty, no filtering is performed and every contract
 	/// found in the supplied sources is compiled.
@@ -189,7 +204,7 @@ public:
 	/// Enable QRVM Bytecode generation. This is enabled by default.
 	void enableQrvmBytecodeGeneration(bool _enable = true) { m_generateQrvmBytecode = _enable; }
 
-	/// Enable generation of Yul IR code.
+	/// Enable generation of Yul IR code. Has to be enabled to request any of the IR outputs.
 	void enableIRGeneration(bool _enable = true) { m_generateIR = _enable; }
 
 	/// @arg _metadataLiteralSources When true, store sources as literals in the contract metadata.
@@ -204,6 +219,11 @@ public:
 	/// Select components of debug info that should be included in comments in generated assembly.
 	void selectDebugInfo(langutil::DebugInfoSelection _debugInfoSelection);
 
+	/// Sets a cache of optimized Yul code that outlives this compilation, so that later
+	/// compilations (e.g. by a long-running compiler process) can reuse unchanged objects.
+	/// It is kept on reset().
+	void setPersistentOptimizedCodeCache(std::shared_ptr<yul::PersistentOptimizedCodeCache> _cache);
+
 	/// Sets the sources. Must be set before parsing.
 	void setSources(StringMap _sources);
 
@@ -364,6 +384,22 @@ private:
 		std::string const& ipfsUrl() const;
 	};
 
+	/// The result of parsing a single source on a worker thread.
+	struct ParsedSource
+	{
+		/// The character stream the source unit was parsed from.
+		std::shared_ptr<langutil::CharStream> charStream;
+		/// The parsed source unit, with node IDs starting at one.
+		std::shared_ptr<SourceUnit> ast;
+		/// The ID of the last node created while parsing, i.e. the number of IDs used.
+		int64_t lastNodeID = 0;
+		/// All nodes created while parsing, including the ones not reachable through the
+		/// AST visitor, e.g. the documentation of structs.
+		std::vector<std::weak_ptr<ASTNode>> nodes;
+		/// True if parsing succeeded without any diagnostics.
+		bool successful = false;
+	};
+
 	/// The state per contract. Filled gradually during compilation.
 	struct Contract
 	{
@@ -374,9 +410,12 @@ private:
 		qrvmasm::LinkerObject object; ///< Deployment object (includes the runtime sub-object).
 		qrvmasm::LinkerObject runtimeObject; ///< Runtime object.
 		std::string yulIR; ///< Yul IR code.
-		std::string yulIROptimized; ///< Optimized Yul IR code.
-		Json::Value yulIRAst; ///< JSON AST of Yul IR code.
-		Json::Value yulIROptimizedAst; ///< JSON AST of optimized Yul IR code.
+		/// Optimized and analyzed Yul IR object. Not set if the contract cannot be deployed.
+		/// Released after bytecode generation unless IR generation is enabled.
+		std::shared_ptr<yul::YulStack const> yulIROptimizedStack;
+		util::LazyInit<std::string const> yulIROptimized; ///< Optimized Yul IR code.
+		util::LazyInit<Json::Value const> yulIRAst; ///< JSON AST of Yul IR code.
+		util::LazyInit<Json::Value const> yulIROptimizedAst; ///< JSON AST of optimized Yul IR code.
 		util::LazyInit<std::string const> metadata; ///< The metadata json that will be hashed into the chain.
 		util::LazyInit<Json::Value const> abi;
 		util::LazyInit<Json::Value const> storageLayout;
@@ -395,6 +434,11 @@ private:
 	/// @a m_readFile
 	/// @returns the newly loaded sources.
 	StringMap loadMissingSources(SourceUnit const& _ast);
+	/// Parses the sources at @a _paths on a pool of worker threads, independently of each other.
+	/// Sources that contain inline assembly are skipped, because the Yul parser relies on
+	/// process-wide state. Nothing is parsed if there would be only a single thread.
+	/// @returns the results for the sources that were parsed.
+	std::map<std::string, ParsedSource> parseConcurrently(std::vector<std::string> const& _paths) const;
 	std::string applyRemapping(std::string const& _path, std::string const& _context);
 	bool resolveImports();
 
@@ -482,6 +526,18 @@ private:
 	/// This will generate the metadata and store it in the Contract object if it is not present yet.
 	std::string const& metadata(Contract const& _contract) const;
 
+	/// @returns the JSON AST of the unoptimized IR of the contract.
+	/// This will parse the IR again and store the JSON AST in the Contract object if it is not present yet.
+	Json::Value const& yulIRAst(Contract const&) const;
+
+	/// @returns the optimized IR of the contract.
+	/// This will print the optimized IR and store it in the Contract object if it is not present yet.
+	std::string const& yulIROptimized(Contract const&) const;
+
+	/// @returns the JSON AST of the optimized IR of the contract.
+	/// This will generate the JSON AST and store it in the Contract object if it is not present yet.
+	Json::Value const& yulIROptimizedAst(Contract const&) const;
+
 	/// @returns the offset of the entry point of the given function into the list of assembly items
 	/// or zero if it is not found or does not exist.
 	size_t functionEntryPoint(
@@ -495,6 +551,7 @@ private:
 	State m_stopAfter = State::CompilationSuccessful;
 	bool m_viaIR = false;
 	langutil::QRVMVersion m_qrvmVersion;
+	size_t m_parserThreadCount = util::availableThreadCount();
 	ModelCheckerSettings m_modelCheckerSettings;
 	std::map<std::string, std::set<std::string>> m_requestedContractNames;
 	bool m_generateQrvmBytecode = true;
@@ -507,6 +564,13 @@ private:
 	std::shared_ptr<GlobalContext> m_globalContext;
 	std::vector<Source const*> m_sourceOrder;
 	std::map<std::string const, Contract> m_contracts;
+	/// Optimized code of the Yul objects of all contracts, so that the object of a contract
+	/// embedded into its creators is optimized only once. Only alive during compile(), so that
+	/// the code of contracts whose outputs are no longer needed is released afterwards.
+	std::shared_ptr<yul::OptimizedCodeCache> m_optimizedCodeCache;
+	std::shared_ptr<yul::PersistentOptimizedCodeCache> m_persistentOptimizedCodeCache;
+	/// Yul helper functions generated for one contract that are reused for the IR of the others.
+	std::shared_ptr<SharedYulFunctionCache> m_sharedYulFunctions;
 
 	langutil::ErrorList m_errorList;
 	langutil::ErrorReporter m_errorReporter;
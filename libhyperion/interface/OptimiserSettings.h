@@ -123,6 +123,7 @@ struct OptimiserSettings
 			optimizeStackAllocation == _other.optimizeStackAllocation &&
 			runYulOptimiser == _other.runYulOptimiser &&
 			yulOptimiserSteps == _other.yulOptimiserSteps &&
+			yulOptimiserMinRoundGain == _other.yulOptimiserMinRoundGain &&
 			expectedExecutionsPerDeployment == _other.expectedExecutionsPerDeployment;
 	}
 
@@ -162,6 +163,10 @@ struct OptimiserSettings
 	/// is left empty, there will still be hard-coded optimisation steps that will run regardless.
 	/// Set @a runYulOptimiser to false if you want no optimisations.
 	std::string yulOptimiserCleanupSteps = DefaultYulOptimiserCleanupSteps;
+	/// Minimum reduction of the code size, in percent, that a round of a repeated (bracketed)
+	/// part of the Yul optimiser sequence has to achieve for the next round to run.
+	/// Zero repeats until the code size no longer changes.
+	size_t yulOptimiserMinRoundGain = 0;
 	/// This specifies an estimate on how often each opcode in this assembly will be executed,
 	/// i.e. use a small value to optimise for size and a large value to optimise for runtime gas usage.
 	size_t expectedExecutionsPerDeployment = 200;
@@ -37,6 +37,7 @@
 
 #include <libhyputil/JSON.h>
 #include <libhyputil/Keccak256.h>
+#include <libhyputil/LazyInit.h>
 #include <libhyputil/CommonData.h>
 #include <libhyputil/VMConstants.h>
 
@@ -617,12 +618,19 @@ std::variant<OptimiserSettings, Json::Value> parseOptimizerSettings(Json::Value
 				return {std::move(settings)};
 			}
 
-			if (auto result = checkKeys(details["yulDetails"], {"stackAllocation", "optimizerSteps"}, "settings.optimizer.details.yulDetails"))
+			if (auto result = checkKeys(details["yulDetails"], {"stackAllocation", "optimizerSteps", "minRoundGain"}, "settings.optimizer.details.yulDetails"))
 				return *result;
 			if (auto error = checkOptimizerDetail(details["yulDetails"], "stackAllocation", settings.optimizeStackAllocation))
 				return *error;
 			if (auto error = checkOptimizerDetailSteps(details["yulDetails"], "optimizerSteps", settings.yulOptimiserSteps, settings.yulOptimiserCleanupSteps, settings.runYulOptimiser))
 				return *error;
+			if (details["yulDetails"].isMember("minRoundGain"))
+			{
+				Json::Value const& minRoundGain = details["yulDetails"]["minRoundGain"];
+				if (!minRoundGain.isUInt() || minRoundGain.asUInt() > 100)
+					return formatFatalError(Error::Type::JSONError, "The \"minRoundGain\" setting must be an unsigned number not greater than 100.");
+				settings.yulOptimiserMinRoundGain = minRoundGain.asUInt();
+			}
 		}
 	}
 	return {std::move(settings)};
@@ -674,7 +682,7 @@ std::variant<StandardCompiler::InputsAndSettings, Json::Value> StandardCompiler:
 						"Mismatch between content and supplied hash for \"" + sourceName + "\""
 					));
 				else
-					ret.sources[sourceName] = content;
+					ret.sources[sourceName] = std::move(content);
 			}
 			else if (sources[sourceName]["urls"].isArray())
 			{
@@ -701,7 +709,7 @@ std::variant<StandardCompiler::InputsAndSettings, Json::Value> StandardCompiler:
 							));
 						else
 						{
-							ret.sources[sourceName] = result.responseOrErrorMessage;
+							ret.sources[sourceName] = std::move(result.responseOrErrorMessage);
 							found = true;
 							break;
 						}
@@ -729,7 +737,7 @@ std::variant<StandardCompiler::InputsAndSettings, Json::Value> StandardCompiler:
 	else if (ret.language == "HyperionAST")
 	{
 		for (auto const& sourceName: sources.getMemberNames())
-			ret.sources[sourceName] = util::jsonCompactPrint(sources[sourceName]);
+			ret.jsonSources[sourceName] = sources[sourceName];
 	}
 
 	Json::Value const& auxInputs = _input["auxiliaryInput"];
@@ -1138,19 +1146,17 @@ std::variant<StandardCompiler::InputsAndSettings, Json::Value> StandardCompiler:
 	return {std::move(ret)};
 }
 
-std::map<std::string, Json::Value> StandardCompiler::parseAstFromInput(StringMap const& _sources)
+std::map<std::string, Json::Value> StandardCompiler::parseAstFromInput(std::map<std::string, Json::Value> const& _sources)
 {
 	std::map<std::string, Json::Value> sourceJsons;
-	for (auto const& [sourceName, sourceCode]: _sources)
+	for (auto const& [sourceName, ast]: _sources)
 	{
-		Json::Value ast;
-		astAssert(util::jsonParseStrict(sourceCode, ast), "Input file could not be parsed to JSON");
 		std::string astKey = ast.isMember("ast") ? "ast" : "AST";
 
 		astAssert(ast.isMember(astKey), "astkey is not member");
 		astAssert(ast[astKey]["nodeType"].asString() == "SourceUnit", "Top-level node should be a 'SourceUnit'");
 		astAssert(sourceJsons.count(sourceName) == 0, "All sources must have unique names");
-		sourceJsons.emplace(sourceName, std::move(ast[astKey]));
+		sourceJsons.emplace(sourceName, ast[astKey]);
 	}
 	return sourceJsons;
 }
@@ -1158,10 +1164,31 @@ std::map<std::string, Json::Value> StandardCompiler::parseAstFromInput(StringMap
 Json::Value StandardCompiler::compileHyperion(StandardCompiler::InputsAndSettings _inputsAndSettings)
 {
 	CompilerStack compilerStack(m_readFile);
+	compilerStack.setPersistentOptimizedCodeCache(m_persistentOptimizedCodeCache);
 
-	StringMap sourceList = std::move(_inputsAndSettings.sources);
+	// Source code is moved into the compiler stack. Only the assembly output needs it again,
+	// so the map passed there is built on first use.
+	std::vector<std::string> inputSourceNames;
 	if (_inputsAndSettings.language == "Hyperion")
-		compilerStack.setSources(sourceList);
+	{
+		for (auto const& source: _inputsAndSettings.sources)
+			inputSourceNames.push_back(source.first);
+		compilerStack.setSources(std::move(_inputsAndSettings.sources));
+	}
+	util::LazyInit<StringMap const> assemblySourceCodes;
+	auto const sourceCodes = [&]() -> StringMap const& {
+		return assemblySourceCodes.init([&]() {
+			StringMap sourceList;
+			if (_inputsAndSettings.language == "Hyperion")
+				for (std::string const& sourceName: inputSourceNames)
+					sourceList[sourceName] = compilerStack.charStream(sourceName).source();
+			else
+				// For imported ASTs, the serialised AST takes the role of the source code.
+				for (auto const& [sourceName, ast]: _inputsAndSettings.jsonSources)
+					sourceList[sourceName] = util::jsonCompactPrint(ast);
+			return sourceList;
+		});
+	};
 	for (auto const& smtLib2Response: _inputsAndSettings.smtLib2Responses)
 		compilerStack.addSMTLib2Response(smtLib2Response.first, smtLib2Response.second);
 	compilerStack.setViaIR(_inputsAndSettings.viaIR);
@@ -1191,7 +1218,7 @@ Json::Value StandardCompiler::compileHyperion(StandardCompiler::InputsAndSetting
 		{
 			try
 			{
-				compilerStack.importASTs(parseAstFromInput(sourceList));
+				compilerStack.importASTs(parseAstFromInput(_inputsAndSettings.jsonSources));
 				if (!compilerStack.analyze())
 					errors.append(formatError(Error::Type::FatalError, "general", "Analysis of the AST failed."));
 				if (binariesRequested)
@@ -1390,7 +1417,7 @@ Json::Value StandardCompiler::compileHyperion(StandardCompiler::InputsAndSetting
 		// QRVM
 		Json::Value qrvmData(Json::objectValue);
 		if (compilationSuccess && isArtifactRequested(_inputsAndSettings.outputSelection, file, name, "qrvm.assembly", wildcardMatchesExperimental))
-			qrvmData["assembly"] = compilerStack.assemblyString(contractName, sourceList);
+			qrvmData["assembly"] = compilerStack.assemblyString(contractName, sourceCodes());
 		if (compilationSuccess && isArtifactRequested(_inputsAndSettings.outputSelection, file, name, "qrvm.legacyAssembly", wildcardMatchesExperimental))
 			qrvmData["legacyAssembly"] = compilerStack.assemblyJSON(contractName);
 		if (isArtifactRequested(_inputsAndSettings.outputSelection, file, name, "qrvm.methodIdentifiers", wildcardMatchesExperimental))
@@ -1499,13 +1526,20 @@ Json::Value StandardCompiler::compileYul(InputsAndSettings _inputsAndSettings)
 		return output;
 	}
 
+	std::shared_ptr<OptimizedCodeCache> optimizedCodeCache;
+	if (m_persistentOptimizedCodeCache)
+	{
+		optimizedCodeCache = std::make_shared<OptimizedCodeCache>();
+		optimizedCodeCache->persistent = m_persistentOptimizedCodeCache;
+	}
 	YulStack stack(
 		_inputsAndSettings.qrvmVersion,
 		YulStack::Language::StrictAssembly,
 		_inputsAndSettings.optimiserSettings,
 		_inputsAndSettings.debugInfoSelection.has_value() ?
 			_inputsAndSettings.debugInfoSelection.value() :
-			DebugInfoSelection::Default()
+			DebugInfoSelection::Default(),
+		std::move(optimizedCodeCache)
 	);
 	std::string const& sourceName = _inputsAndSettings.sources.begin()->first;
 	std::string const& sourceContents = _inputsAndSettings.sources.begin()->second;
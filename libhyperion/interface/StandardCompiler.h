@@ -28,6 +28,7 @@
 
 #include <liblangutil/DebugInfoSelection.h>
 
+#include <memory>
 #include <optional>
 #include <utility>
 #include <variant>
@@ -63,6 +64,12 @@ public:
 	/// output. Parsing errors are returned as regular errors.
 	std::string compile(std::string const& _input) noexcept;
 
+	/// Sets a cache of optimized Yul code that is shared by all following compilations.
+	void setPersistentOptimizedCodeCache(std::shared_ptr<yul::PersistentOptimizedCodeCache> _cache)
+	{
+		m_persistentOptimizedCodeCache = std::move(_cache);
+	}
+
 	static Json::Value formatFunctionDebugData(
 		std::map<std::string, qrvmasm::LinkerObject::FunctionDebugData> const& _debugInfo
 	);
@@ -74,6 +81,8 @@ private:
 		Json::Value errors;
 		CompilerStack::State stopAfter = CompilerStack::State::CompilationSuccessful;
 		std::map<std::string, std::string> sources;
+		/// Source units of the "HyperionAST" language, kept as parsed from the input.
+		std::map<std::string, Json::Value> jsonSources;
 		std::map<util::h256, std::string> smtLib2Responses;
 		langutil::QRVMVersion qrvmVersion;
 		std::vector<ImportRemapper::Remapping> remappings;
@@ -93,13 +102,15 @@ private:
 	/// it in condensed form or an error as a json object.
 	std::variant<InputsAndSettings, Json::Value> parseInput(Json::Value const& _input);
 
-	std::map<std::string, Json::Value> parseAstFromInput(StringMap const& _sources);
+	std::map<std::string, Json::Value> parseAstFromInput(std::map<std::string, Json::Value> const& _sources);
 	Json::Value compileHyperion(InputsAndSettings _inputsAndSettings);
 	Json::Value compileYul(InputsAndSettings _inputsAndSettings);
 
 	ReadCallback::Callback m_readFile;
 
 	util::JsonFormat m_jsonPrintingFormat;
+
+	std::shared_ptr<yul::PersistentOptimizedCodeCache> m_persistentOptimizedCodeCache;
 };
 
 }
@@ -76,7 +76,7 @@ public:
 		hypAssert(m_location.sourceName, "");
 		if (m_location.end < 0)
 			markEndPosition();
-		return std::make_shared<NodeType>(m_parser.nextID(), m_location, std::forward<Args>(_args)...);
+		return m_parser.createNodeWithNextID<NodeType>(m_location, std::forward<Args>(_args)...);
 	}
 
 	SourceLocation const& location() const noexcept { return m_location; }
@@ -1386,7 +1386,7 @@ ASTPointer<InlineAssembly> Parser::parseInlineAssembly(ASTPointer<ASTString> con
 		BOOST_THROW_EXCEPTION(FatalError());
 
 	location.end = nativeLocationOf(*block).end;
-	return std::make_shared<InlineAssembly>(nextID(), location, _docString, dialect, std::move(flags), block);
+	return createNodeWithNextID<InlineAssembly>(location, _docString, dialect, std::move(flags), block);
 }
 
 ASTPointer<IfStatement> Parser::parseIfStatement(ASTPointer<ASTString> const& _docString)
@@ -27,6 +27,10 @@
 #include <liblangutil/ParserBase.h>
 #include <liblangutil/QRVMVersion.h>
 
+#include <memory>
+#include <optional>
+#include <vector>
+
 namespace hyperion::langutil
 {
 class CharStream;
@@ -38,16 +42,32 @@ namespace hyperion::frontend
 class Parser: public langutil::ParserBase
 {
 public:
+	/// @param _lastNodeID the ID after which the IDs of the created nodes start.
 	explicit Parser(
 		langutil::ErrorReporter& _errorReporter,
-		langutil::QRVMVersion _qrvmVersion
+		langutil::QRVMVersion _qrvmVersion,
+		int64_t _lastNodeID = 0
 	):
 		ParserBase(_errorReporter),
-		m_qrvmVersion(_qrvmVersion)
+		m_qrvmVersion(_qrvmVersion),
+		m_currentNodeID(_lastNodeID)
 	{}
 
 	ASTPointer<SourceUnit> parse(langutil::CharStream& _charStream);
 
+	/// @returns the ID of the most recently created AST node.
+	int64_t lastNodeID() const { return m_currentNodeID; }
+
+	/// Makes the parser remember all AST nodes it creates from now on, so that they can be
+	/// renumbered with ASTNode::shiftIDs.
+	void recordCreatedNodes() { m_createdNodes.emplace(); }
+	/// @returns the nodes created since the call to recordCreatedNodes.
+	std::vector<std::weak_ptr<ASTNode>> const& createdNodes() const
+	{
+		hypAssert(m_createdNodes.has_value());
+		return *m_createdNodes;
+	}
+
 private:
 	class ASTNodeFactory;
 
@@ -197,6 +217,15 @@ private:
 
 	/// Returns the next AST node ID
 	int64_t nextID() { return ++m_currentNodeID; }
+	/// Creates an AST node with the next ID and remembers it if requested.
+	template <class NodeType, typename... Args>
+	ASTPointer<NodeType> createNodeWithNextID(Args&&... _args)
+	{
+		auto node = std::make_shared<NodeType>(nextID(), std::forward<Args>(_args)...);
+		if (m_createdNodes)
+			m_createdNodes->emplace_back(node);
+		return node;
+	}
 
 	std::pair<LookAheadInfo, IndexAccessedPath> tryParseIndexAccessedPath();
 	/// Performs limited look-ahead to distinguish between variable declaration and expression statement.
@@ -231,6 +260,8 @@ private:
 	langutil::QRVMVersion m_qrvmVersion;
 	/// Counter for the next AST node ID
 	int64_t m_currentNodeID = 0;
+	/// All nodes created so far, only filled if recordCreatedNodes was called.
+	std::optional<std::vector<std::weak_ptr<ASTNode>>> m_createdNodes;
 	/// Flag that indicates whether experimental mode is enabled in the current source unit
 	bool m_experimentalHyperionEnabledInCurrentSourceUnit = false;
 };
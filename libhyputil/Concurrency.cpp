@@ -0,0 +1,128 @@
+/*
+	This file is part of hyperion.
+
+	hyperion is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	hyperion is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with hyperion.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Helpers for running independent tasks on several threads.
+ */
+
+#include <libhyputil/Concurrency.h>
+
+#include <algorithm>
+#include <atomic>
+#include <optional>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <pthread.h>
+#endif
+
+using namespace hyperion;
+using namespace hyperion::util;
+
+namespace
+{
+
+#if defined(__unix__) || defined(__APPLE__)
+
+/// Stack size of the worker threads. The default stack of secondary threads is as small as
+/// 512 KiB on macOS, which does not suffice for the recursion depth allowed by the parser.
+/// This is the stack size of the main thread of hypc on macOS (see QRLCompilerSettings.cmake).
+size_t constexpr workerStackSize = 32 * 1024 * 1024;
+
+using Worker = pthread_t;
+
+void* runWork(void* _work)
+{
+	(*static_cast<std::function<void()> const*>(_work))();
+	return nullptr;
+}
+
+std::optional<Worker> startWorker(std::function<void()> const& _work)
+{
+	pthread_attr_t attributes;
+	if (pthread_attr_init(&attributes) != 0)
+		return std::nullopt;
+	Worker worker;
+	bool started =
+		pthread_attr_setstacksize(&attributes, workerStackSize) == 0 &&
+		pthread_create(&worker, &attributes, runWork, const_cast<std::function<void()>*>(&_work)) == 0;
+	pthread_attr_destroy(&attributes);
+	if (!started)
+		return std::nullopt;
+	return worker;
+}
+
+void joinWorker(Worker& _worker)
+{
+	pthread_join(_worker, nullptr);
+}
+
+#else
+
+// On Windows, threads get the stack size of the main thread, which is set by the linker.
+using Worker = std::thread;
+
+std::optional<Worker> startWorker(std::function<void()> const& _work)
+{
+	try
+	{
+		return Worker{_work};
+	}
+	catch (std::system_error const&)
+	{
+		return std::nullopt;
+	}
+}
+
+void joinWorker(Worker& _worker)
+{
+	_worker.join();
+}
+
+#endif
+
+}
+
+size_t hyperion::util::availableThreadCount()
+{
+	return std::max<size_t>(std::thread::hardware_concurrency(), 1);
+}
+
+void hyperion::util::forEachIndexConcurrently(
+	size_t _count,
+	size_t _threadCount,
+	std::function<void(size_t)> const& _task
+)
+{
+	std::atomic<size_t> nextIndex = 0;
+	std::function<void()> const work = [&]() {
+		for (size_t index = nextIndex++; index < _count; index = nextIndex++)
+			_task(index);
+	};
+
+	std::vector<Worker> workers;
+	for (size_t i = 1; i < std::min(_count, _threadCount); ++i)
+		if (std::optional<Worker> worker = startWorker(work))
+			workers.emplace_back(std::move(*worker));
+		else
+			break;
+	work();
+	for (Worker& worker: workers)
+		joinWorker(worker);
+}
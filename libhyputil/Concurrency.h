@@ -0,0 +1,42 @@
+/*
+	This file is part of hyperion.
+
+	hyperion is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	hyperion is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with hyperion.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Helpers for running independent tasks on several threads.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+
+namespace hyperion::util
+{
+
+/// @returns the number of threads to use for concurrent work, at least one.
+size_t availableThreadCount();
+
+/// Calls @a _task for every index in [0, @a _count) on up to @a _threadCount threads,
+/// including the calling thread, and returns once all calls have finished.
+/// Threads are started with a stack large enough for the recursion depth allowed by the parser.
+/// If a thread cannot be started, for example in builds without thread support, the
+/// remaining indices are processed by the threads already running, in the worst case
+/// by the calling thread alone.
+/// @a _task must not throw.
+void forEachIndexConcurrently(size_t _count, size_t _threadCount, std::function<void(size_t)> const& _task);
+
+}
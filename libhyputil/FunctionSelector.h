@@ -21,7 +21,11 @@
 #include <libhyputil/Keccak256.h>
 #include <libhyputil/FixedHash.h>
 
+#include <algorithm>
+#include <array>
+#include <cstdint>
 #include <string>
+#include <string_view>
 
 namespace hyperion::util
 {
@@ -44,4 +48,101 @@ inline u256 selectorFromSignatureU256(std::string const& _signature)
 	return u256(selectorFromSignatureU32(_signature)) << (256 - 32);
 }
 
+namespace detail
+{
+
+constexpr uint64_t rotateLeft(uint64_t _value, unsigned _bits)
+{
+	return _bits == 0 ? _value : (_value << _bits) | (_value >> (64 - _bits));
+}
+
+/// Keccak-f[1600] permutation that can be evaluated at compile time.
+/// The run time implementation in Keccak256.cpp is considerably faster.
+constexpr void keccakf(std::array<uint64_t, 25>& _state)
+{
+	uint64_t const roundConstants[24] = {
+		0x0000000000000001, 0x0000000000008082, 0x800000000000808a, 0x8000000080008000,
+		0x000000000000808b, 0x0000000080000001, 0x8000000080008081, 0x8000000000008009,
+		0x000000000000008a, 0x0000000000000088, 0x0000000080008009, 0x000000008000000a,
+		0x000000008000808b, 0x800000000000008b, 0x8000000000008089, 0x8000000000008003,
+		0x8000000000008002, 0x8000000000000080, 0x000000000000800a, 0x800000008000000a,
+		0x8000000080008081, 0x8000000000008080, 0x0000000080000001, 0x8000000080008008
+	};
+	unsigned const rotations[24] = {1, 3, 6, 10, 15, 21, 28, 36, 45, 55, 2, 14, 27, 41, 56, 8, 25, 43, 62, 18, 39, 61, 20, 44};
+	size_t const positions[24] = {10, 7, 11, 17, 18, 3, 5, 16, 8, 21, 24, 4, 15, 23, 19, 13, 12, 2, 20, 14, 22, 9, 6, 1};
+
+	for (uint64_t roundConstant: roundConstants)
+	{
+		// Theta
+		uint64_t columns[5] = {};
+		for (size_t x = 0; x < 5; ++x)
+			columns[x] = _state[x] ^ _state[x + 5] ^ _state[x + 10] ^ _state[x + 15] ^ _state[x + 20];
+		for (size_t x = 0; x < 5; ++x)
+		{
+			uint64_t const difference = columns[(x + 4) % 5] ^ rotateLeft(columns[(x + 1) % 5], 1);
+			for (size_t y = 0; y < 25; y += 5)
+				_state[y + x] ^= difference;
+		}
+		// Rho and pi
+		uint64_t current = _state[1];
+		for (size_t i = 0; i < 24; ++i)
+		{
+			uint64_t const next = _state[positions[i]];
+			_state[positions[i]] = rotateLeft(current, rotations[i]);
+			current = next;
+		}
+		// Chi
+		for (size_t y = 0; y < 25; y += 5)
+		{
+			uint64_t row[5] = {};
+			for (size_t x = 0; x < 5; ++x)
+				row[x] = _state[y + x];
+			for (size_t x = 0; x < 5; ++x)
+				_state[y + x] = row[x] ^ (~row[(x + 1) % 5] & row[(x + 2) % 5]);
+		}
+		// Iota
+		_state[0] ^= roundConstant;
+	}
+}
+
+}
+
+/// @returns the ABI selector for a given function signature, as a 32 bit number.
+/// Meant for signatures known at compile time: used to initialise a constexpr variable,
+/// the hash is not computed at run time at all.
+constexpr uint32_t selectorFromSignatureConstexpr(std::string_view _signature)
+{
+	size_t const rate = 200 - (256 / 4);
+	std::array<uint64_t, 25> state{};
+	for (size_t offset = 0; ; offset += rate)
+	{
+		size_t const blockSize = std::min(rate, _signature.size() - offset);
+		for (size_t i = 0; i < blockSize; ++i)
+			state[i / 8] ^= uint64_t(uint8_t(_signature[offset + i])) << (8 * (i % 8));
+		if (blockSize < rate)
+		{
+			// Keccak padding, see the run time implementation.
+			state[blockSize / 8] ^= uint64_t(0x01) << (8 * (blockSize % 8));
+			state[(rate - 1) / 8] ^= uint64_t(0x80) << (8 * ((rate - 1) % 8));
+			detail::keccakf(state);
+			break;
+		}
+		detail::keccakf(state);
+	}
+	// The selector consists of the first four bytes of the hash, i.e. of the lowest four bytes
+	// of the first lane.
+	uint64_t const lane = state[0];
+	return uint32_t(
+		((lane & 0xff) << 24) |
+		(((lane >> 8) & 0xff) << 16) |
+		(((lane >> 16) & 0xff) << 8) |
+		((lane >> 24) & 0xff)
+	);
+}
+
+/// ABI selector of Error(string), used when reverting with a reason string.
+constexpr uint32_t c_errorStringSelector = selectorFromSignatureConstexpr("Error(string)");
+/// ABI selector of Panic(uint256), used when reverting with a panic code.
+constexpr uint32_t c_panicSelector = selectorFromSignatureConstexpr("Panic(uint256)");
+
 }
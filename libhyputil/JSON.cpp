@@ -24,10 +24,10 @@
 
 #include <libhyputil/CommonIO.h>
 
-#include <boost/algorithm/string/replace.hpp>
-
-#include <sstream>
 #include <map>
+#include <sstream>
+#include <streambuf>
+#include <string_view>
 #include <memory>
 
 static_assert(
@@ -62,16 +62,83 @@ public:
 	}
 };
 
+/// Stream buffer that forwards everything to a target stream, except for spaces that are
+/// directly followed by a newline. Pretty printing leaves those behind at the end of lines.
+class TrailingSpaceFilter: public std::streambuf
+{
+public:
+	explicit TrailingSpaceFilter(std::ostream& _target): m_target(_target) {}
+
+	/// Writes out a space that was held back at the end of the input.
+	void finish()
+	{
+		if (m_pendingSpace)
+			m_target.put(' ');
+		m_pendingSpace = false;
+	}
+
+protected:
+	int_type overflow(int_type _char) override
+	{
+		if (traits_type::eq_int_type(_char, traits_type::eof()))
+			return traits_type::not_eof(_char);
+		char const c = traits_type::to_char_type(_char);
+		xsputn(&c, 1);
+		return _char;
+	}
+
+	std::streamsize xsputn(char const* _data, std::streamsize _size) override
+	{
+		std::string_view input(_data, static_cast<size_t>(_size));
+		if (input.empty())
+			return 0;
+
+		// A space is only written once it is clear that no newline follows.
+		if (m_pendingSpace && input.front() != '\n')
+			m_target.put(' ');
+		m_pendingSpace = (input.back() == ' ');
+		if (m_pendingSpace)
+			input.remove_suffix(1);
+
+		size_t position = 0;
+		for (size_t found = input.find(" \n"); found != std::string_view::npos; found = input.find(" \n", found + 2))
+		{
+			write(input.substr(position, found - position));
+			position = found + 1;
+		}
+		write(input.substr(position));
+		return _size;
+	}
+
+private:
+	void write(std::string_view _data) { m_target.write(_data.data(), static_cast<std::streamsize>(_data.size())); }
+
+	std::ostream& m_target;
+	bool m_pendingSpace = false;
+};
+
 /// Serialise the JSON object (@a _input) with specific builder (@a _builder)
+/// \param _stream stream the serialized json object is written to
 /// \param _input JSON input string
 /// \param _builder StreamWriterBuilder that is used to create new Json::StreamWriter
-/// \return serialized json object
-std::string print(Json::Value const& _input, Json::StreamWriterBuilder const& _builder)
+void print(std::ostream& _stream, Json::Value const& _input, Json::StreamWriterBuilder const& _builder)
 {
-	std::stringstream stream;
 	std::unique_ptr<Json::StreamWriter> writer(_builder.newStreamWriter());
-	writer->write(_input, &stream);
-	return stream.str();
+	writer->write(_input, &_stream);
+}
+
+/// @returns the writer settings for the given format (@a _format).
+std::map<std::string, Json::Value> writerSettings(JsonFormat const& _format)
+{
+	std::map<std::string, Json::Value> settings;
+	if (_format.format == JsonFormat::Pretty)
+	{
+		settings["indentation"] = std::string(_format.indent, ' ');
+		settings["enableYAMLCompatibility"] = true;
+	}
+	else
+		settings["indentation"] = "";
+	return settings;
 }
 
 /// Parse a JSON string (@a _input) with specified builder (@ _builder) and writes resulting JSON object to (@a _json)
@@ -123,19 +190,23 @@ std::string jsonCompactPrint(Json::Value const& _input)
 
 std::string jsonPrint(Json::Value const& _input, JsonFormat const& _format)
 {
-	std::map<std::string, Json::Value> settings;
+	std::ostringstream stream;
+	jsonPrint(stream, _input, _format);
+	return stream.str();
+}
+
+void jsonPrint(std::ostream& _stream, Json::Value const& _input, JsonFormat const& _format)
+{
+	StreamWriterBuilder writerBuilder(writerSettings(_format));
 	if (_format.format == JsonFormat::Pretty)
 	{
-		settings["indentation"] = std::string(_format.indent, ' ');
-		settings["enableYAMLCompatibility"] = true;
+		TrailingSpaceFilter filter(_stream);
+		std::ostream filteredStream(&filter);
+		print(filteredStream, _input, writerBuilder);
+		filter.finish();
 	}
 	else
-		settings["indentation"] = "";
-	StreamWriterBuilder writerBuilder(settings);
-	std::string result = print(_input, writerBuilder);
-	if (_format.format == JsonFormat::Pretty)
-		boost::replace_all(result, " \n", "\n");
-	return result;
+		print(_stream, _input, writerBuilder);
 }
 
 bool jsonParseStrict(std::string const& _input, Json::Value& _json, std::string* _errs /* = nullptr */)
@@ -26,10 +26,37 @@
 
 #include <libhyputil/Assertions.h>
 
-#include <regex>
+#include <algorithm>
 
 using namespace hyperion::util;
 
+namespace
+{
+
+bool isParameterCharacter(char _c)
+{
+	return
+		('a' <= _c && _c <= 'z') ||
+		('A' <= _c && _c <= 'Z') ||
+		('0' <= _c && _c <= '9') ||
+		_c == '_' || _c == '$' || _c == '-';
+}
+
+/// @returns the end of the (possibly empty) run of parameter characters starting at @a _pos.
+size_t parameterEnd(std::string const& _text, size_t _pos)
+{
+	while (_pos < _text.size() && isParameterCharacter(_text[_pos]))
+		++_pos;
+	return _pos;
+}
+
+bool startsWithAt(std::string const& _text, size_t _pos, std::string const& _prefix)
+{
+	return _text.compare(_pos, _prefix.size(), _prefix) == 0;
+}
+
+}
+
 Whiskers::Whiskers(std::string _template):
 	m_template(std::move(_template))
 {
@@ -76,20 +103,30 @@ std::string Whiskers::render() const
 
 void Whiskers::checkTemplateValid() const
 {
-	std::regex validTemplate("<[#?!\\/]\\+{0,1}[a-zA-Z0-9_$-]+(?:[^a-zA-Z0-9_$>-]|$)");
-	std::smatch match;
-	assertThrow(
-		!regex_search(m_template, match, validTemplate),
-		WhiskersError,
-		"Template contains an invalid/unclosed tag " + match.str()
-	);
+	// Rejects any opening, else or closing tag whose name is not directly followed by '>'.
+	for (size_t pos = m_template.find('<'); pos != std::string::npos; pos = m_template.find('<', pos + 1))
+	{
+		size_t nameStart = pos + 1;
+		if (nameStart >= m_template.size() || std::string("#?!/").find(m_template[nameStart]) == std::string::npos)
+			continue;
+		++nameStart;
+		if (nameStart < m_template.size() && m_template[nameStart] == '+')
+			++nameStart;
+		size_t nameEnd = parameterEnd(m_template, nameStart);
+		if (nameEnd == nameStart || (nameEnd < m_template.size() && m_template[nameEnd] == '>'))
+			continue;
+		assertThrow(
+			false,
+			WhiskersError,
+			"Template contains an invalid/unclosed tag " + m_template.substr(pos, nameEnd + 1 - pos)
+		);
+	}
 }
 
 void Whiskers::checkParameterValid(std::string const& _parameter) const
 {
-	static std::regex validParam("^" + paramRegex() + "$");
 	assertThrow(
-		regex_match(_parameter, validParam),
+		!_parameter.empty() && std::all_of(_parameter.begin(), _parameter.end(), isParameterCharacter),
 		WhiskersError,
 		"Parameter" + _parameter + " contains invalid characters."
 	);
@@ -127,32 +164,6 @@ void Whiskers::checkTemplateContainsTags(std::string const& _parameter, std::vec
 	}
 }
 
-namespace
-{
-template<class ReplaceCallback>
-std::string regex_replace(
-	std::string const& _source,
-	std::regex const& _pattern,
-	ReplaceCallback _replace,
-	std::regex_constants::match_flag_type _flags = std::regex_constants::match_default
-)
-{
-	std::sregex_iterator curMatch(_source.begin(), _source.end(), _pattern, _flags);
-	std::sregex_iterator matchEnd;
-	std::string::const_iterator lastMatchedPos(_source.cbegin());
-	std::string result;
-	while (curMatch != matchEnd)
-	{
-		result.append(curMatch->prefix().first, curMatch->prefix().second);
-		result.append(_replace(*curMatch));
-		lastMatchedPos = (*curMatch)[0].second;
-		++curMatch;
-	}
-	result.append(lastMatchedPos, _source.cend());
-	return result;
-}
-}
-
 std::string Whiskers::replace(
 	std::string const& _template,
 	StringMap const& _parameters,
@@ -160,18 +171,24 @@ std::string Whiskers::replace(
 	std::map<std::string, std::vector<StringMap>> const& _listParameters
 )
 {
-	static std::regex listOrTag(
-		"<(" + paramRegex() + ")>|"
-		"<#(" + paramRegex() + ")>((?:.|\\r|\\n)*?)</\\2>|"
-		"<\\?(\\+?" + paramRegex() + ")>((?:.|\\r|\\n)*?)(<!\\4>((?:.|\\r|\\n)*?))?</\\4>"
-	);
-	return regex_replace(_template, listOrTag, [&](std::match_results<std::string::const_iterator> _match) -> std::string
+	// Single left-to-right scan. A list or condition extends to the first matching closing
+	// tag after its opening tag, which means that tags of the same name cannot be nested.
+	// Anything that does not form a complete tag is copied verbatim.
+	std::string result;
+	size_t copiedUntil = 0;
+	for (size_t pos = _template.find('<'); pos != std::string::npos; pos = _template.find('<', pos))
 	{
-		std::string tagName(_match[1]);
-		std::string listName(_match[2]);
-		std::string conditionName(_match[4]);
-		if (!tagName.empty())
+		size_t const nameStart = pos + 1;
+		char const kind = nameStart < _template.size() ? _template[nameStart] : '\0';
+		if (kind != '#' && kind != '?')
 		{
+			size_t nameEnd = parameterEnd(_template, nameStart);
+			if (nameEnd == nameStart || nameEnd >= _template.size() || _template[nameEnd] != '>')
+			{
+				++pos;
+				continue;
+			}
+			std::string tagName = _template.substr(nameStart, nameEnd - nameStart);
 			assertThrow(
 				_parameters.count(tagName),
 				WhiskersError,
@@ -179,51 +196,104 @@ std::string Whiskers::replace(
 				"Template:\n" +
 				_template
 			);
-			return _parameters.at(tagName);
+			result.append(_template, copiedUntil, pos - copiedUntil);
+			result += _parameters.at(tagName);
+			pos = copiedUntil = nameEnd + 1;
+			continue;
 		}
-		else if (!listName.empty())
+
+		size_t const conditionNameStart =
+			(kind == '?' && nameStart + 1 < _template.size() && _template[nameStart + 1] == '+') ?
+			nameStart + 2 :
+			nameStart + 1;
+		size_t const nameEnd = parameterEnd(_template, conditionNameStart);
+		if (nameEnd == conditionNameStart || nameEnd >= _template.size() || _template[nameEnd] != '>')
 		{
-			std::string templ(_match[3]);
+			++pos;
+			continue;
+		}
+		std::string const name = _template.substr(nameStart + 1, nameEnd - nameStart - 1);
+		std::string const closingTag = "</" + name + ">";
+		size_t const bodyStart = nameEnd + 1;
+
+		if (kind == '#')
+		{
+			size_t bodyEnd = _template.find(closingTag, bodyStart);
+			if (bodyEnd == std::string::npos)
+			{
+				++pos;
+				continue;
+			}
 			assertThrow(
-				_listParameters.count(listName),
-				WhiskersError, "List parameter " + listName + " not set."
+				_listParameters.count(name),
+				WhiskersError, "List parameter " + name + " not set."
 			);
-			std::string replacement;
-			for (auto const& parameters: _listParameters.at(listName))
-				replacement += replace(templ, joinMaps(_parameters, parameters), _conditions);
-			return replacement;
+			std::string templ = _template.substr(bodyStart, bodyEnd - bodyStart);
+			result.append(_template, copiedUntil, pos - copiedUntil);
+			for (auto const& parameters: _listParameters.at(name))
+				result += replace(templ, joinMaps(_parameters, parameters), _conditions);
+			pos = copiedUntil = bodyEnd + closingTag.size();
+			continue;
 		}
-		else
+
+		std::string const elseTag = "<!" + name + ">";
+		size_t bodyEnd = _template.find('<', bodyStart);
+		size_t elseStart = std::string::npos;
+		size_t end = std::string::npos;
+		// The first of "<!name>" and "</name>" decides whether there is an else branch.
+		for (; bodyEnd != std::string::npos; bodyEnd = _template.find('<', bodyEnd + 1))
 		{
-			assertThrow(!conditionName.empty(), WhiskersError, "");
-			bool conditionValue = false;
-			if (conditionName[0] == '+')
+			if (startsWithAt(_template, bodyEnd, closingTag))
 			{
-				std::string tag = conditionName.substr(1);
-
-				if (_parameters.count(tag))
-					conditionValue = !_parameters.at(tag).empty();
-				else if (_listParameters.count(tag))
-					conditionValue = !_listParameters.at(tag).empty();
-				else
-					assertThrow(false, WhiskersError, "Tag " + tag + " used as condition but was not set.");
+				end = bodyEnd + closingTag.size();
+				break;
 			}
-			else
+			if (startsWithAt(_template, bodyEnd, elseTag))
 			{
-				assertThrow(
-					_conditions.count(conditionName),
-					WhiskersError, "Condition parameter " + conditionName + " not set."
-				);
-				conditionValue = _conditions.at(conditionName);
+				elseStart = bodyEnd + elseTag.size();
+				size_t elseEnd = _template.find(closingTag, elseStart);
+				if (elseEnd != std::string::npos)
+					end = elseEnd + closingTag.size();
+				break;
 			}
-			return replace(
-				conditionValue ? _match[5] : _match[7],
-				_parameters,
-				_conditions,
-				_listParameters
+		}
+		if (end == std::string::npos)
+		{
+			++pos;
+			continue;
+		}
+
+		bool conditionValue = false;
+		if (name[0] == '+')
+		{
+			std::string tag = name.substr(1);
+
+			if (_parameters.count(tag))
+				conditionValue = !_parameters.at(tag).empty();
+			else if (_listParameters.count(tag))
+				conditionValue = !_listParameters.at(tag).empty();
+			else
+				assertThrow(false, WhiskersError, "Tag " + tag + " used as condition but was not set.");
+		}
+		else
+		{
+			assertThrow(
+				_conditions.count(name),
+				WhiskersError, "Condition parameter " + name + " not set."
 			);
+			conditionValue = _conditions.at(name);
 		}
-	});
+		std::string branch;
+		if (conditionValue)
+			branch = _template.substr(bodyStart, bodyEnd - bodyStart);
+		else if (elseStart != std::string::npos)
+			branch = _template.substr(elseStart, end - closingTag.size() - elseStart);
+		result.append(_template, copiedUntil, pos - copiedUntil);
+		result += replace(branch, _parameters, _conditions, _listParameters);
+		pos = copiedUntil = end;
+	}
+	result.append(_template, copiedUntil, std::string::npos);
+	return result;
 }
 
 Whiskers::StringMap Whiskers::joinMaps(
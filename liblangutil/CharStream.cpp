@@ -51,6 +51,8 @@
 #include <liblangutil/CharStream.h>
 #include <liblangutil/Exceptions.h>
 
+#include <algorithm>
+
 using namespace hyperion;
 using namespace hyperion::langutil;
 
@@ -85,11 +87,8 @@ std::string CharStream::lineAtPosition(int _position) const
 	size_type searchStart = std::min<size_type>(m_source.size(), size_type(_position));
 	if (searchStart > 0)
 		searchStart--;
-	size_type lineStart = m_source.rfind('\n', searchStart);
-	if (lineStart == std::string::npos)
-		lineStart = 0;
-	else
-		lineStart++;
+	// Start of the line containing searchStart, or of the next one if searchStart is a line feed.
+	size_type lineStart = lineStarts()[lineIndex(searchStart + 1)];
 	std::string line = m_source.substr(
 		lineStart,
 		std::min(m_source.find('\n', lineStart), m_source.size()) - lineStart
@@ -102,18 +101,31 @@ std::string CharStream::lineAtPosition(int _position) const
 LineColumn CharStream::translatePositionToLineColumn(int _position) const
 {
 	using size_type = std::string::size_type;
-	using diff_type = std::string::difference_type;
 	size_type searchPosition = std::min<size_type>(m_source.size(), size_type(_position));
-	int lineNumber = static_cast<int>(count(m_source.begin(), m_source.begin() + diff_type(searchPosition), '\n'));
-	size_type lineStart;
-	if (searchPosition == 0)
-		lineStart = 0;
-	else
+	size_t line = lineIndex(searchPosition);
+	return LineColumn{static_cast<int>(line), static_cast<int>(searchPosition - lineStarts()[line])};
+}
+
+std::vector<size_t> const& CharStream::lineStarts() const
+{
+	if (m_lineStarts.empty())
 	{
-		lineStart = m_source.rfind('\n', searchPosition - 1);
-		lineStart = lineStart == std::string::npos ? 0 : lineStart + 1;
+		m_lineStarts.push_back(0);
+		for (
+			size_t newLine = m_source.find('\n');
+			newLine != std::string::npos;
+			newLine = m_source.find('\n', newLine + 1)
+		)
+			m_lineStarts.push_back(newLine + 1);
 	}
-	return LineColumn{lineNumber, static_cast<int>(searchPosition - lineStart)};
+	return m_lineStarts;
+}
+
+size_t CharStream::lineIndex(size_t _position) const
+{
+	std::vector<size_t> const& starts = lineStarts();
+	// The line containing the position is the last one that starts at or before it.
+	return static_cast<size_t>(std::upper_bound(starts.begin(), starts.end(), _position) - starts.begin()) - 1;
 }
 
 std::string_view CharStream::text(SourceLocation const& _location) const
@@ -146,12 +158,24 @@ std::string CharStream::singleLineSnippet(std::string const& _sourceCode, Source
 
 std::optional<int> CharStream::translateLineColumnToPosition(LineColumn const& _lineColumn) const
 {
-	return translateLineColumnToPosition(m_source, _lineColumn);
+	if (_lineColumn.line < 0 || _lineColumn.column < 0)
+		return std::nullopt;
+
+	std::vector<size_t> const& starts = lineStarts();
+	size_t line = static_cast<size_t>(_lineColumn.line);
+	if (line >= starts.size())
+		return std::nullopt;
+
+	size_t offset = starts[line];
+	size_t endOfLine = line + 1 < starts.size() ? starts[line + 1] - 1 : m_source.size();
+	if (offset + static_cast<size_t>(_lineColumn.column) > endOfLine)
+		return std::nullopt;
+	return static_cast<int>(offset + static_cast<size_t>(_lineColumn.column));
 }
 
 std::optional<int> CharStream::translateLineColumnToPosition(std::string const& _text, LineColumn const& _input)
 {
-	if (_input.line < 0)
+	if (_input.line < 0 || _input.column < 0)
 		return std::nullopt;
 
 	size_t offset = 0;
@@ -55,6 +55,7 @@
 #include <string>
 #include <tuple>
 #include <utility>
+#include <vector>
 
 namespace hyperion::langutil
 {
@@ -102,8 +103,9 @@ public:
 
 	///@{
 	///@name Error printing helper functions
-	/// Functions that help pretty-printing parse errors
-	/// Do only use in error cases, they are quite expensive.
+	/// Functions that help pretty-printing parse errors.
+	/// They use an index of line start offsets that is built on first use and then
+	/// find the line by binary search.
 	std::string lineAtPosition(int _position) const;
 	LineColumn translatePositionToLineColumn(int _position) const;
 	///@}
@@ -142,10 +144,18 @@ public:
 	static std::string singleLineSnippet(std::string const& _sourceCode, SourceLocation const& _location);
 
 private:
+	/// @returns the offsets of the first character of each line, building them on first use.
+	std::vector<size_t> const& lineStarts() const;
+	/// @returns the index of the line containing the character at @a _position.
+	size_t lineIndex(size_t _position) const;
+
 	std::string m_source;
 	std::string m_name;
 	bool m_importedFromAST{false};
 	size_t m_position{0};
+	/// Offsets of the first character of each line, lazily computed by lineStarts().
+	/// The source does not change after construction, so the index never has to be invalidated.
+	mutable std::vector<size_t> m_lineStarts;
 };
 
 }
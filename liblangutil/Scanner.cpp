@@ -57,6 +57,7 @@
 
 #include <boost/algorithm/string/classification.hpp>
 
+#include <algorithm>
 #include <optional>
 #include <string_view>
 #include <tuple>
@@ -284,25 +285,31 @@ static ScannerError validateBiDiMarkup(CharStream& _stream, size_t _startPositio
 		std::pair<std::string_view, int>{"\xE2\x80\xAC", -1} // U+202C (PDF - Pop Directional Formatting
 	};
 
-	size_t endPosition = _stream.position();
-	_stream.setPosition(_startPosition);
+	std::string_view const source = _stream.source();
+	size_t const endPosition = _stream.position();
 
 	int directionOverrideDepth = 0;
 
-	for (size_t currentPos = _startPosition; currentPos < endPosition; ++currentPos)
+	// All directional sequences share the same lead byte, so only its occurrences have to be inspected.
+	for (
+		size_t currentPos = source.find('\xE2', _startPosition);
+		currentPos < endPosition;
+		currentPos = source.find('\xE2', currentPos + 1)
+	)
 	{
-		_stream.setPosition(currentPos);
-
 		for (auto const& [sequence, depthChange]: directionalSequences)
-			if (_stream.prefixMatch(sequence))
+			// Same bounds as CharStream::prefixMatch: the sequence must not reach the end of the input.
+			if (currentPos + sequence.size() < source.size() && source.substr(currentPos, sequence.size()) == sequence)
 				directionOverrideDepth += depthChange;
 
 		if (directionOverrideDepth < 0)
+		{
+			// Scanning resumes right at the offending sequence.
+			_stream.setPosition(currentPos);
 			return ScannerError::DirectionalOverrideUnderflow;
+		}
 	}
 
-	_stream.setPosition(endPosition);
-
 	return directionOverrideDepth > 0 ? ScannerError::DirectionalOverrideMismatch : ScannerError::NoError;
 }
 
@@ -313,6 +320,11 @@ Token Scanner::skipSingleLineComment()
 	// Line terminator is not part of the comment. If it is a
 	// non-ascii line terminator, it will result in a parser error.
 	size_t startPosition = m_source.position();
+	// Fast-forward to the first character that can start a line terminator.
+	m_char = m_source.setPosition(std::min(
+		m_source.source().find_first_of("\n\v\f\r\xC2\xE2", startPosition),
+		m_source.size()
+	));
 	while (!isUnicodeLinebreak())
 		if (!advance())
 			break;
@@ -395,6 +407,14 @@ Token Scanner::skipMultiLineComment()
 	size_t startPosition = m_source.position();
 	while (!isSourcePastEndOfInput())
 	{
+		// Only a '*' can start the terminator, so skip ahead to the next one.
+		if (m_char != '*')
+		{
+			m_char = m_source.setPosition(std::min(m_source.source().find('*', sourcePos()), m_source.size()));
+			if (isSourcePastEndOfInput())
+				break;
+		}
+
 		char prevChar = m_char;
 		advance();
 
@@ -919,9 +939,11 @@ void Scanner::scanDecimalDigits()
 		return;
 
 	// May continue with decimal digit or underscore for grouping.
+	size_t const start = sourcePos();
 	do
-		addLiteralCharAndAdvance();
+		advance();
 	while (!m_source.isPastEndOfInput() && (isDecimalDigit(m_char) || m_char == '_'));
+	m_tokens[NextNext].literal.append(m_source.source(), start, sourcePos() - start);
 
 	// Defer further validation of underscore to SyntaxChecker.
 }
@@ -1052,10 +1074,12 @@ std::tuple<Token, unsigned, unsigned> Scanner::scanIdentifierOrKeyword()
 {
 	hypAssert(isIdentifierStart(m_char), "");
 	LiteralScope literal(this, LITERAL_TYPE_STRING);
-	addLiteralCharAndAdvance();
-	// Scan the rest of the identifier characters.
+	size_t const start = sourcePos();
+	advance();
+	// Scan the rest of the identifier characters and copy them in one go.
 	while (isIdentifierPart(m_char) || (m_char == '.' && m_kind == ScannerKind::Yul))
-		addLiteralCharAndAdvance();
+		advance();
+	m_tokens[NextNext].literal.assign(m_source.source(), start, sourcePos() - start);
 	literal.complete();
 
 	auto const token = TokenTraits::fromIdentifierOrKeyword(m_tokens[NextNext].literal);
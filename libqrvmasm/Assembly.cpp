@@ -69,14 +69,24 @@ AssemblyItem const& Assembly::append(AssemblyItem _i)
 
 unsigned Assembly::codeSize(unsigned subTagSize) const
 {
-	for (unsigned tagSize = subTagSize; true; ++tagSize)
+	// Only pushed tags, data and sub references depend on the tag size, each by exactly one byte
+	// per byte of tag size. Split the code size into that part and the rest, so that finding the
+	// smallest tag size that can address the whole code does not need to walk the items again.
+	size_t fixedSize = 1;
+	for (auto const& i: m_data)
+		fixedSize += i.second.size();
+
+	size_t tagSizedReferences = 0;
+	for (AssemblyItem const& i: m_items)
 	{
-		size_t ret = 1;
-		for (auto const& i: m_data)
-			ret += i.second.size();
+		fixedSize += i.bytesRequired(0, Precision::Approximate);
+		if (i.type() == PushTag || i.type() == PushData || i.type() == PushSub)
+			++tagSizedReferences;
+	}
 
-		for (AssemblyItem const& i: m_items)
-			ret += i.bytesRequired(tagSize, Precision::Approximate);
+	for (unsigned tagSize = subTagSize; true; ++tagSize)
+	{
+		size_t ret = fixedSize + tagSizedReferences * tagSize;
 		if (numberEncodingSize(ret) <= tagSize)
 			return static_cast<unsigned>(ret);
 	}
@@ -784,11 +794,17 @@ std::map<u512, u512> const& Assembly::optimiseInternal(
 				return _i == AssemblyItem{Instruction::MSIZE} || _i.type() == VerbatimBytecode;
 			});
 
+			// Knowledge is carried from one chunk into the next only along the fall-through
+			// edge of a JUMPI: the code following it up to the next tag can only be entered from
+			// the preceding chunk, which therefore dominates it. It is not carried across the
+			// split of overlong chunks, since the expression classes would grow without bound.
+			// Tags are join points with unknown predecessors, so we start from scratch there.
+			// Merging the knowledge of all predecessors at a tag is not implemented.
+			KnownState knownState;
 			auto iter = m_items.begin();
 			while (iter != m_items.end())
 			{
-				KnownState emptyState;
-				CommonSubexpressionEliminator eliminator{emptyState};
+				CommonSubexpressionEliminator eliminator{knownState};
 				auto orig = iter;
 				iter = eliminator.feedItems(iter, m_items.end(), usesMSize);
 				bool shouldReplace = false;
@@ -816,6 +832,11 @@ std::map<u512, u512> const& Assembly::optimiseInternal(
 				}
 				else
 					copy(orig, iter, back_inserter(optimisedItems));
+
+				if (iter != m_items.end() && iter->type() != Tag && *std::prev(iter) == AssemblyItem(Instruction::JUMPI))
+					knownState = eliminator.nextInitialState();
+				else
+					knownState = KnownState{};
 			}
 			if (optimisedItems.size() < m_items.size())
 			{
@@ -887,7 +908,11 @@ LinkerObject const& Assembly::assemble() const
 
 	unsigned bytesRequiredForCode = codeSize(static_cast<unsigned>(subTagSize));
 	m_tagPositionsInBytecode = std::vector<size_t>(m_usedTags, std::numeric_limits<size_t>::max());
-	std::map<size_t, std::pair<size_t, size_t>> tagRef;
+	// Item index of each tag, used for the function debug data of named tags.
+	std::vector<std::optional<size_t>> tagIndices(m_usedTags);
+	// Bytecode offsets of pushed tags together with the (sub id, tag id) they refer to.
+	// Offsets are recorded in increasing order, so a vector suffices.
+	std::vector<std::pair<size_t, std::pair<size_t, size_t>>> tagRef;
 	std::multimap<h256, unsigned> dataRef;
 	std::multimap<size_t, size_t> subRef;
 	std::vector<unsigned> sizeRef; ///< Pointers to code locations where the size of the program is inserted
@@ -902,7 +927,7 @@ LinkerObject const& Assembly::assemble() const
 	uint8_t dataRefPush = static_cast<uint8_t>(pushInstruction(bytesPerDataRef));
 	ret.bytecode.reserve(bytesRequiredIncludingData);
 
-	for (AssemblyItem const& i: m_items)
+	for (auto&& [index, i]: m_items | ranges::views::enumerate)
 	{
 		// store position of the invalid jump destination
 		if (i.type() != Tag && m_tagPositionsInBytecode[0] == std::numeric_limits<size_t>::max())
@@ -928,7 +953,7 @@ LinkerObject const& Assembly::assemble() const
 		case PushTag:
 		{
 			ret.bytecode.push_back(tagPush);
-			tagRef[ret.bytecode.size()] = i.splitForeignPushTag();
+			tagRef.emplace_back(ret.bytecode.size(), i.splitForeignPushTag());
 			ret.bytecode.resize(ret.bytecode.size() + bytesPerTag);
 			break;
 		}
@@ -1017,6 +1042,7 @@ LinkerObject const& Assembly::assemble() const
 			assertThrow(ret.bytecode.size() < 0xffffffffL, AssemblyException, "Tag too large.");
 			assertThrow(m_tagPositionsInBytecode[tagId] == std::numeric_limits<size_t>::max(), AssemblyException, "Duplicate tag position.");
 			m_tagPositionsInBytecode[tagId] = ret.bytecode.size();
+			tagIndices[tagId] = index;
 			ret.bytecode.push_back(static_cast<uint8_t>(Instruction::JUMPDEST));
 			break;
 		}
@@ -1056,11 +1082,9 @@ LinkerObject const& Assembly::assemble() const
 		for (auto const& ref: subObject.linkReferences)
 			ret.linkReferences[ref.first + subAssemblyOffsets[subObject]] = ref.second;
 	}
-	for (auto const& i: tagRef)
+	for (auto const& [bytecodeOffset, subIdAndTagId]: tagRef)
 	{
-		size_t subId;
-		size_t tagId;
-		std::tie(subId, tagId) = i.second;
+		auto const& [subId, tagId] = subIdAndTagId;
 		assertThrow(subId == std::numeric_limits<size_t>::max() || subId < m_subs.size(), AssemblyException, "Invalid sub id");
 		std::vector<size_t> const& tagPositions =
 			subId == std::numeric_limits<size_t>::max() ?
@@ -1070,22 +1094,15 @@ LinkerObject const& Assembly::assemble() const
 		size_t pos = tagPositions[tagId];
 		assertThrow(pos != std::numeric_limits<size_t>::max(), AssemblyException, "Reference to tag without position.");
 		assertThrow(numberEncodingSize(pos) <= bytesPerTag, AssemblyException, "Tag too large for reserved space.");
-		bytesRef r(ret.bytecode.data() + i.first, bytesPerTag);
+		bytesRef r(ret.bytecode.data() + bytecodeOffset, bytesPerTag);
 		toBigEndian(pos, r);
 	}
 	for (auto const& [name, tagInfo]: m_namedTags)
 	{
 		size_t position = m_tagPositionsInBytecode.at(tagInfo.id);
-		std::optional<size_t> tagIndex;
-		for (auto&& [index, item]: m_items | ranges::views::enumerate)
-			if (item.type() == Tag && static_cast<size_t>(item.data()) == tagInfo.id)
-			{
-				tagIndex = index;
-				break;
-			}
 		ret.functionDebugData[name] = {
 			position == std::numeric_limits<size_t>::max() ? std::nullopt : std::optional<size_t>{position},
-			tagIndex,
+			tagIndices.at(tagInfo.id),
 			tagInfo.sourceID,
 			tagInfo.params,
 			tagInfo.returns
@@ -77,6 +77,11 @@ public:
 	/// @returns the resulting items after optimization.
 	AssemblyItems getOptimizedItems();
 
+	/// @returns the knowledge about the state after the items returned by the last call to
+	/// @a getOptimizedItems (including the breaking item), which can be used as the initial
+	/// state for the code that directly follows them.
+	KnownState const& nextInitialState() const { return m_initialState; }
+
 private:
 	/// Feeds the item into the system for analysis.
 	void feedItem(AssemblyItem const& _item, bool _copyItem = false);
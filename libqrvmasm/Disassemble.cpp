@@ -20,12 +20,32 @@
 
 #include <libhyputil/Common.h>
 #include <libhyputil/CommonIO.h>
+
+#include <boost/multiprecision/cpp_int.hpp>
+
+#include <algorithm>
 #include <functional>
 
 using namespace hyperion;
 using namespace hyperion::util;
 using namespace hyperion::qrvmasm;
 
+namespace
+{
+
+/// @returns the number of immediate bytes following each opcode.
+std::array<uint8_t, 256> const& immediateSizes()
+{
+	static std::array<uint8_t, 256> const sizes = []() {
+		std::array<uint8_t, 256> result{};
+		for (size_t opcode = 0; opcode < result.size(); ++opcode)
+			result[opcode] = static_cast<uint8_t>(instructionInfo(Instruction(opcode)).additional);
+		return result;
+	}();
+	return sizes;
+}
+
+}
 
 void hyperion::qrvmasm::eachInstruction(
 	bytes const& _mem,
@@ -35,23 +55,20 @@ void hyperion::qrvmasm::eachInstruction(
 	for (auto it = _mem.begin(); it < _mem.end(); ++it)
 	{
 		Instruction const instr{*it};
-		int additional = 0;
+		size_t additional = 0;
 		if (isValidInstruction(instr))
-			additional = instructionInfo(instr).additional;
+			additional = static_cast<size_t>(instructionInfo(instr).additional);
 
 		u512 data{};
-
-		// fill the data with the additional data bytes from the instruction stream
-		while (additional > 0 && std::next(it) < _mem.end())
+		// fill the data with the additional data bytes from the instruction stream at once
+		size_t available = std::min(additional, static_cast<size_t>(_mem.end() - std::next(it)));
+		if (available > 0)
 		{
-			data <<= 8;
-			data |= *++it;
-			--additional;
+			boost::multiprecision::import_bits(data, std::next(it), std::next(it, static_cast<ptrdiff_t>(available + 1)));
+			it += static_cast<ptrdiff_t>(available);
 		}
-
 		// pad the remaining number of additional octets with zeros
-		data <<= 8 * additional;
-
+		data <<= 8 * (additional - available);
 		_onInstruction(instr, data);
 	}
 }
@@ -64,7 +81,7 @@ std::string hyperion::qrvmasm::disassemble(bytes const& _mem, std::string const&
 			ret << "0x" << std::uppercase << std::hex << static_cast<int>(_instr) << _delimiter;
 		else
 		{
-			InstructionInfo info = instructionInfo(_instr);
+			InstructionInfo const& info = instructionInfo(_instr);
 			ret << info.name;
 			if (info.additional)
 				ret << " 0x" << std::uppercase << std::hex << _data;
@@ -73,3 +90,33 @@ std::string hyperion::qrvmasm::disassemble(bytes const& _mem, std::string const&
 	});
 	return ret.str();
 }
+
+std::optional<size_t> hyperion::qrvmasm::metadataOffset(bytesConstRef _code)
+{
+	if (_code.size() < 2)
+		return std::nullopt;
+	// The metadata is a CBOR map followed by its length as a 16-bit big endian number.
+	size_t const length = (static_cast<size_t>(_code[_code.size() - 2]) << 8) | _code[_code.size() - 1];
+	if (length == 0 || length + 2 > _code.size())
+		return std::nullopt;
+	size_t const offset = _code.size() - 2 - length;
+	if ((_code[offset] & 0xe0) != 0xa0)
+		return std::nullopt;
+	return offset;
+}
+
+CodeStatistics hyperion::qrvmasm::codeStatistics(bytesConstRef _code)
+{
+	CodeStatistics statistics;
+	statistics.metadataOffset = metadataOffset(_code);
+	size_t const end = statistics.metadataOffset.value_or(_code.size());
+	std::array<uint8_t, 256> const& immediates = immediateSizes();
+	for (size_t position = 0; position < end; position += 1u + immediates[_code[position]])
+	{
+		uint8_t const opcode = _code[position];
+		++statistics.opcodeCounts[opcode];
+		if (opcode == static_cast<uint8_t>(Instruction::JUMPDEST))
+			statistics.jumpdests.push_back(position);
+	}
+	return statistics;
+}
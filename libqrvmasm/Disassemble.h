@@ -23,8 +23,11 @@
 
 #include <libqrvmasm/Instruction.h>
 
+#include <array>
 #include <functional>
+#include <optional>
 #include <string>
+#include <vector>
 
 namespace hyperion::qrvmasm
 {
@@ -35,4 +38,23 @@ void eachInstruction(bytes const& _mem, std::function<void(Instruction, u512 con
 /// Convert from QRVM code to simple QRVM assembly language.
 std::string disassemble(bytes const& _mem, std::string const& _delimiter = " ");
 
+/// @returns the offset at which the CBOR encoded metadata appended by the compiler starts,
+/// if the code ends in a length field that points at a CBOR map.
+std::optional<size_t> metadataOffset(bytesConstRef _code);
+
+/// Opcode statistics of a piece of QRVM code.
+struct CodeStatistics
+{
+	/// Number of occurrences of each opcode, not counting push data and metadata.
+	std::array<size_t, 256> opcodeCounts{};
+	/// Offsets of all JUMPDEST instructions.
+	std::vector<size_t> jumpdests;
+	/// Offset of the CBOR encoded metadata, if present.
+	std::optional<size_t> metadataOffset;
+};
+
+/// Collect opcode statistics in a single pass over @a _code.
+/// Unlike eachInstruction, push data is skipped without being decoded.
+CodeStatistics codeStatistics(bytesConstRef _code);
+
 }
@@ -22,6 +22,8 @@
 
 #include <libqrvmasm/Instruction.h>
 
+#include <array>
+
 using namespace hyperion;
 using namespace hyperion::util;
 using namespace hyperion::qrvmasm;
@@ -383,19 +385,43 @@ static std::map<Instruction, InstructionInfo> const c_instructionInfo =
 	{ Instruction::INVALID,		{ "INVALID",		0, 0, 0, true, Tier::Zero } }
 };
 
-InstructionInfo hyperion::qrvmasm::instructionInfo(Instruction _inst)
+namespace
 {
-	try
-	{
-		return c_instructionInfo.at(_inst);
-	}
-	catch (...)
+
+/// Information on all 256 possible opcodes, indexed by opcode, so that looking up an instruction
+/// is a single array access and does not copy its name.
+struct InstructionInfoTable
+{
+	InstructionInfoTable()
 	{
-		return InstructionInfo({"<INVALID_INSTRUCTION: " + std::to_string(static_cast<unsigned>(_inst)) + ">", 0, 0, 0, false, Tier::Invalid});
+		for (size_t opcode = 0; opcode < infos.size(); ++opcode)
+			if (auto it = c_instructionInfo.find(Instruction(opcode)); it != c_instructionInfo.end())
+			{
+				infos[opcode] = it->second;
+				valid[opcode] = true;
+			}
+			else
+				infos[opcode] = {"<INVALID_INSTRUCTION: " + std::to_string(opcode) + ">", 0, 0, 0, false, Tier::Invalid};
 	}
+
+	std::array<InstructionInfo, 256> infos;
+	std::array<bool, 256> valid{};
+};
+
+InstructionInfoTable const& instructionInfoTable()
+{
+	static InstructionInfoTable const table;
+	return table;
+}
+
+}
+
+InstructionInfo const& hyperion::qrvmasm::instructionInfo(Instruction _inst)
+{
+	return instructionInfoTable().infos[static_cast<uint8_t>(_inst)];
 }
 
 bool hyperion::qrvmasm::isValidInstruction(Instruction _inst)
 {
-	return !!c_instructionInfo.count(_inst);
+	return instructionInfoTable().valid[static_cast<uint8_t>(_inst)];
 }
@@ -27,6 +27,9 @@
 #include <libhyputil/Keccak256.h>
 #include <libhyputil/VMConstants.h>
 
+#include <boost/container_hash/hash.hpp>
+
+#include <algorithm>
 #include <functional>
 
 using namespace hyperion;
@@ -132,7 +135,7 @@ KnownState::StoreOperation KnownState::feedItem(AssemblyItem const& _item, bool
 		Instruction instruction = _item.instruction();
 		// The latest QRVMVersion is used here, since the InstructionInfo is assumed to be
 		// the same across all QRVM versions except for the instruction name.
-		InstructionInfo info = instructionInfo(instruction);
+		InstructionInfo const& info = instructionInfo(instruction);
 		if (SemanticInformation::isDupInstruction(_item))
 			setStackElement(
 				m_stackHeight + 1,
@@ -277,6 +280,46 @@ bool KnownState::operator==(KnownState const& _other) const
 	return (thisIt == m_stackElements.cend() && otherIt == _other.m_stackElements.cend());
 }
 
+bool KnownState::isIdenticalTo(KnownState const& _other) const
+{
+	return
+		m_expressionClasses == _other.m_expressionClasses &&
+		m_stackHeight == _other.m_stackHeight &&
+		m_sequenceNumber == _other.m_sequenceNumber &&
+		m_stackElements == _other.m_stackElements &&
+		m_storageContent == _other.m_storageContent &&
+		m_memoryContent == _other.m_memoryContent &&
+		m_knownKeccak256Hashes == _other.m_knownKeccak256Hashes &&
+		std::equal(
+			m_tagUnions.left.begin(),
+			m_tagUnions.left.end(),
+			_other.m_tagUnions.left.begin(),
+			_other.m_tagUnions.left.end(),
+			[](auto const& _a, auto const& _b) { return _a.first == _b.first && _a.second == _b.second; }
+		);
+}
+
+size_t KnownState::hash() const
+{
+	size_t result = 0;
+	boost::hash_combine(result, m_stackHeight);
+	boost::hash_combine(result, m_sequenceNumber);
+	for (auto const& [height, id]: m_stackElements)
+	{
+		boost::hash_combine(result, height);
+		boost::hash_combine(result, id);
+	}
+	for (auto const& content: {std::cref(m_storageContent), std::cref(m_memoryContent)})
+		for (auto const& [slot, value]: content.get())
+		{
+			boost::hash_combine(result, slot);
+			boost::hash_combine(result, value);
+		}
+	boost::hash_combine(result, m_knownKeccak256Hashes.size());
+	boost::hash_combine(result, m_tagUnions.size());
+	return result;
+}
+
 ExpressionClasses::Id KnownState::stackElement(int _stackHeight, SourceLocation const& _location)
 {
 	if (m_stackElements.count(_stackHeight))
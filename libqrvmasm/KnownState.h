@@ -131,6 +131,12 @@ public:
 
 	/// @returns true if the knowledge about the state of both objects is (known to be) equal.
 	bool operator==(KnownState const& _other) const;
+	/// @returns true if both states share their expression classes and hold exactly the same
+	/// knowledge at the same absolute stack height and sequence number, i.e. feeding the same
+	/// items to both results in the same state.
+	bool isIdenticalTo(KnownState const& _other) const;
+	/// @returns a hash value that is equal for identical states, see isIdenticalTo.
+	size_t hash() const;
 
 	/// Retrieves the current equivalence class for the given stack element (or generates a new
 	/// one if it does not exist yet).
@@ -30,9 +30,24 @@ using namespace hyperion::qrvmasm;
 PathGasMeter::PathGasMeter(AssemblyItems const& _items, langutil::QRVMVersion _qrvmVersion):
 	m_items(_items), m_qrvmVersion(_qrvmVersion)
 {
+	m_controlFlowKinds.reserve(m_items.size());
 	for (size_t i = 0; i < m_items.size(); ++i)
-		if (m_items[i].type() == Tag)
-			m_tagPositions[m_items[i].data()] = i;
+	{
+		AssemblyItem const& item = m_items[i];
+		if (item.type() == Tag)
+			m_tagPositions[item.data()] = i;
+
+		if (item.type() == Tag || item == AssemblyItem(Instruction::JUMPDEST))
+			m_controlFlowKinds.push_back(ControlFlowKind::Jumpdest);
+		else if (item == AssemblyItem(Instruction::JUMP))
+			m_controlFlowKinds.push_back(ControlFlowKind::Jump);
+		else if (item == AssemblyItem(Instruction::JUMPI))
+			m_controlFlowKinds.push_back(ControlFlowKind::ConditionalJump);
+		else if (SemanticInformation::altersControlFlow(item))
+			m_controlFlowKinds.push_back(ControlFlowKind::Halt);
+		else
+			m_controlFlowKinds.push_back(ControlFlowKind::Other);
+	}
 }
 
 GasMeter::GasConsumption PathGasMeter::estimateMax(
@@ -69,9 +84,8 @@ GasMeter::GasConsumption PathGasMeter::handleQueueItem()
 	std::unique_ptr<GasPath> path = std::move(m_queue.rbegin()->second);
 	m_queue.erase(--m_queue.end());
 
-	std::shared_ptr<KnownState> state = path->state;
-	GasMeter meter(state, m_qrvmVersion, path->largestMemoryAccess);
-	ExpressionClasses& classes = state->expressionClasses();
+	std::shared_ptr<KnownState const> state = std::move(path->state);
+	u256 largestMemoryAccess = path->largestMemoryAccess;
 	GasMeter::GasConsumption gas = path->gas;
 	size_t index = path->index;
 
@@ -81,59 +95,121 @@ GasMeter::GasConsumption PathGasMeter::handleQueueItem()
 		// return the current gas value.
 		return gas;
 
-	std::set<u256> jumpTags;
-	for (; index < m_items.size() && !gas.isInfinite; ++index)
+	while (index < m_items.size())
 	{
-		bool branchStops = false;
-		jumpTags.clear();
-		AssemblyItem const& item = m_items.at(index);
-		if (item.type() == Tag || item == AssemblyItem(Instruction::JUMPDEST))
+		// Do not allow any backwards jump. This is quite restrictive but should work for
+		// the simplest things.
+		if (
+			m_controlFlowKinds[index] == ControlFlowKind::Jumpdest &&
+			!path->visitedJumpdests.insert(index).second
+		)
+			return GasMeter::GasConsumption::infinite();
+
+		BlockSummary const& block = blockSummary(index, state, largestMemoryAccess);
+		if (block.unknownJumpTarget)
+			return GasMeter::GasConsumption::infinite();
+		gas += block.gas;
+		if (gas.isInfinite)
+			return gas;
+		state = block.exitState;
+		largestMemoryAccess = block.exitLargestMemoryAccess;
+		index = block.end;
+
+		size_t remainingJumpTags = block.jumpTags.size();
+		for (u256 const& tag: block.jumpTags)
 		{
-			// Do not allow any backwards jump. This is quite restrictive but should work for
-			// the simplest things.
-			if (path->visitedJumpdests.count(index))
-				return GasMeter::GasConsumption::infinite();
-			path->visitedJumpdests.insert(index);
+			// If this path ends here, the last successor can take over its visited jumpdests
+			// instead of copying them. States are not modified and thus shared.
+			bool lastUse = block.branchStops && --remainingJumpTags == 0;
+			auto newPath = std::make_unique<GasPath>();
+			newPath->index = m_items.size();
+			if (auto position = m_tagPositions.find(tag); position != m_tagPositions.end())
+				newPath->index = position->second;
+			newPath->gas = gas;
+			newPath->largestMemoryAccess = largestMemoryAccess;
+			newPath->state = state;
+			if (lastUse)
+				newPath->visitedJumpdests = std::move(path->visitedJumpdests);
+			else
+				newPath->visitedJumpdests = path->visitedJumpdests;
+			queue(std::move(newPath));
 		}
-		else if (item == AssemblyItem(Instruction::JUMP))
+
+		if (block.branchStops)
+			break;
+	}
+
+	return gas;
+}
+
+PathGasMeter::BlockSummary const& PathGasMeter::blockSummary(
+	size_t _index,
+	std::shared_ptr<KnownState const> const& _state,
+	u256 const& _largestMemoryAccess
+)
+{
+	std::vector<BlockSummary>& summaries = m_blockSummaries[{_index, _state->hash()}];
+	for (BlockSummary const& summary: summaries)
+		if (
+			summary.entryLargestMemoryAccess == _largestMemoryAccess &&
+			(summary.entryState == _state || summary.entryState->isIdenticalTo(*_state))
+		)
+			return summary;
+
+	BlockSummary summary;
+	summary.entryState = _state;
+	summary.entryLargestMemoryAccess = _largestMemoryAccess;
+	std::shared_ptr<KnownState> state = _state->copy();
+	GasMeter meter(state, m_qrvmVersion, _largestMemoryAccess);
+	ExpressionClasses& classes = state->expressionClasses();
+
+	size_t index = _index;
+	for (; index < m_items.size() && !summary.gas.isInfinite; ++index)
+	{
+		ControlFlowKind const kind = m_controlFlowKinds[index];
+		if (kind == ControlFlowKind::Jumpdest && index > _index)
+			// Execution falls through into the next block.
+			break;
+
+		switch (kind)
 		{
-			branchStops = true;
-			jumpTags = state->tagsInExpression(state->relativeStackElement(0));
-			if (jumpTags.empty()) // unknown jump destination
-				return GasMeter::GasConsumption::infinite();
-		}
-		else if (item == AssemblyItem(Instruction::JUMPI))
+		case ControlFlowKind::Jump:
+			summary.branchStops = true;
+			summary.jumpTags = state->tagsInExpression(state->relativeStackElement(0));
+			summary.unknownJumpTarget = summary.jumpTags.empty();
+			break;
+		case ControlFlowKind::ConditionalJump:
 		{
 			ExpressionClasses::Id condition = state->relativeStackElement(-1);
 			if (classes.knownNonZero(condition) || !classes.knownZero(condition))
 			{
-				jumpTags = state->tagsInExpression(state->relativeStackElement(0));
-				if (jumpTags.empty()) // unknown jump destination
-					return GasMeter::GasConsumption::infinite();
+				summary.jumpTags = state->tagsInExpression(state->relativeStackElement(0));
+				summary.unknownJumpTarget = summary.jumpTags.empty();
 			}
-			branchStops = classes.knownNonZero(condition);
+			summary.branchStops = classes.knownNonZero(condition);
+			break;
 		}
-		else if (SemanticInformation::altersControlFlow(item))
-			branchStops = true;
-
-		gas += meter.estimateMax(item);
-
-		for (u256 const& tag: jumpTags)
-		{
-			auto newPath = std::make_unique<GasPath>();
-			newPath->index = m_items.size();
-			if (m_tagPositions.count(tag))
-				newPath->index = m_tagPositions.at(tag);
-			newPath->gas = gas;
-			newPath->largestMemoryAccess = meter.largestMemoryAccess();
-			newPath->state = state->copy();
-			newPath->visitedJumpdests = path->visitedJumpdests;
-			queue(std::move(newPath));
+		case ControlFlowKind::Halt:
+			summary.branchStops = true;
+			break;
+		case ControlFlowKind::Jumpdest:
+		case ControlFlowKind::Other:
+			break;
 		}
 
-		if (branchStops)
+		if (summary.unknownJumpTarget)
+			break;
+		summary.gas += meter.estimateMax(m_items[index]);
+		if (kind != ControlFlowKind::Jumpdest && kind != ControlFlowKind::Other)
+		{
+			++index;
 			break;
+		}
 	}
 
-	return gas;
+	summary.exitState = std::move(state);
+	summary.exitLargestMemoryAccess = meter.largestMemoryAccess();
+	summary.end = index;
+	summaries.emplace_back(std::move(summary));
+	return summaries.back();
 }
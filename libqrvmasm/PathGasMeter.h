@@ -26,6 +26,7 @@
 
 #include <liblangutil/QRVMVersion.h>
 
+#include <map>
 #include <set>
 #include <vector>
 #include <memory>
@@ -38,7 +39,7 @@ class KnownState;
 struct GasPath
 {
 	size_t index = 0;
-	std::shared_ptr<KnownState> state;
+	std::shared_ptr<KnownState const> state;
 	u256 largestMemoryAccess;
 	GasMeter::GasConsumption gas;
 	std::set<size_t> visitedJumpdests;
@@ -74,11 +75,48 @@ private:
 	void queue(std::unique_ptr<GasPath>&& _newPath);
 	GasMeter::GasConsumption handleQueueItem();
 
+	/// Classification of an assembly item with respect to the control flow, computed once
+	/// for all paths that run through the item.
+	enum class ControlFlowKind { Other, Jumpdest, Jump, ConditionalJump, Halt };
+
+	/// Effect of a basic block on a given entry state. A block runs from a jumpdest or the item
+	/// after a conditional jump up to the next jump, halting instruction or jumpdest.
+	struct BlockSummary
+	{
+		/// State and largest memory access the summary was computed for.
+		std::shared_ptr<KnownState const> entryState;
+		u256 entryLargestMemoryAccess;
+		/// Gas consumed by the items of the block.
+		GasMeter::GasConsumption gas;
+		/// State and largest memory access after the last item of the block.
+		std::shared_ptr<KnownState const> exitState;
+		u256 exitLargestMemoryAccess;
+		/// Index of the first item after the block.
+		size_t end = 0;
+		/// Possible targets of the jump at the end of the block.
+		std::set<u256> jumpTags;
+		/// True if the block ends in a jump whose target is not known.
+		bool unknownJumpTarget = false;
+		/// True if execution does not continue at @a end.
+		bool branchStops = false;
+	};
+
+	/// @returns the summary of the block starting at @a _index, which is only computed if the
+	/// block has not been reached in an identical state before.
+	BlockSummary const& blockSummary(
+		size_t _index,
+		std::shared_ptr<KnownState const> const& _state,
+		u256 const& _largestMemoryAccess
+	);
+
 	/// Map of jumpdest -> gas path, so not really a queue. We only have one queued up
 	/// item per jumpdest, because of the behaviour of `queue` above.
 	std::map<size_t, std::unique_ptr<GasPath>> m_queue;
 	std::map<size_t, GasMeter::GasConsumption> m_highestGasUsagePerJumpdest;
 	std::map<u512, size_t> m_tagPositions;
+	/// Block summaries by index of the first item of the block and hash of the entry state.
+	std::map<std::pair<size_t, size_t>, std::vector<BlockSummary>> m_blockSummaries;
+	std::vector<ControlFlowKind> m_controlFlowKinds;
 	AssemblyItems const& m_items;
 	langutil::QRVMVersion m_qrvmVersion;
 };
@@ -24,6 +24,8 @@
 
 #include <libyul/AsmAnalysis.h>
 #include <libyul/AsmAnalysisInfo.h>
+#include <libyul/AsmParser.h>
+#include <libyul/AsmPrinter.h>
 #include <libyul/backends/qrvm/QRLAssemblyAdapter.h>
 #include <libyul/backends/qrvm/QRVMCodeTransform.h>
 #include <libyul/backends/qrvm/QRVMDialect.h>
@@ -35,6 +37,8 @@
 #include <libqrvmasm/Assembly.h>
 #include <liblangutil/Scanner.h>
 #include <libhyperion/interface/OptimiserSettings.h>
+#include <libhyputil/CommonData.h>
+#include <libhyputil/Keccak256.h>
 
 #include <boost/algorithm/string.hpp>
 
@@ -100,6 +104,7 @@ void YulStack::optimize()
 	m_analysisSuccessful = false;
 	yulAssert(m_parserResult, "");
 	optimize(*m_parserResult, true);
+	m_optimizedCodeCache.reset();
 	yulAssert(analyzeParsed(), "Invalid source code after optimization.");
 }
 
@@ -161,6 +166,31 @@ void YulStack::optimize(Object& _object, bool _isCreation)
 			optimize(*subObject, isCreation);
 		}
 
+	std::optional<util::h256> cacheKey;
+	std::optional<util::h256> persistentCacheKey;
+	if (m_optimizedCodeCache)
+	{
+		cacheKey = optimizedCodeCacheKey(_object, _isCreation);
+		if (auto const* cachedCode = util::valueOrNullptr(m_optimizedCodeCache->code, *cacheKey))
+		{
+			// The analysis info is left stale, the whole object is analyzed again after optimization.
+			_object.code = *cachedCode;
+			return;
+		}
+		// Without source names the source locations cannot be restored from the printed code.
+		if (m_optimizedCodeCache->persistent && _object.debugData->sourceNames.has_value())
+		{
+			PersistentOptimizedCodeCache& persistentCache = *m_optimizedCodeCache->persistent;
+			persistentCacheKey = persistentOptimizedCodeCacheKey(_object, *cacheKey);
+			if (auto const* cachedCode = util::valueOrNullptr(persistentCache.code, *persistentCacheKey))
+			{
+				_object.code = parseOptimizedCode(_object, *cachedCode);
+				m_optimizedCodeCache->code.emplace(*cacheKey, _object.code);
+				return;
+			}
+		}
+	}
+
 	Dialect const& dialect = languageToDialect(m_language, m_qrvmVersion);
 	std::unique_ptr<GasMeter> meter;
 	if (QRVMDialect const* qrvmDialect = dynamic_cast<QRVMDialect const*>(&dialect))
@@ -200,8 +230,81 @@ void YulStack::optimize(Object& _object, bool _isCreation)
 		yulOptimiserSteps,
 		yulOptimiserCleanupSteps,
 		_isCreation ? std::nullopt : std::make_optional(m_optimiserSettings.expectedExecutionsPerDeployment),
-		{}
+		{},
+		m_optimiserSettings.yulOptimiserMinRoundGain
 	);
+
+	if (cacheKey)
+		m_optimizedCodeCache->code.emplace(*cacheKey, _object.code);
+	if (persistentCacheKey)
+	{
+		PersistentOptimizedCodeCache& persistentCache = *m_optimizedCodeCache->persistent;
+		std::string code = AsmPrinter(
+			languageToDialect(m_language, m_qrvmVersion),
+			_object.debugData->sourceNames,
+			DebugInfoSelection::All()
+		)(*_object.code);
+		if (persistentCache.size + code.size() > persistentCache.maxSize)
+		{
+			persistentCache.code.clear();
+			persistentCache.size = 0;
+		}
+		if (code.size() <= persistentCache.maxSize)
+		{
+			persistentCache.size += code.size();
+			persistentCache.code.emplace(*persistentCacheKey, std::move(code));
+		}
+	}
+}
+
+util::h256 YulStack::optimizedCodeCacheKey(Object const& _object, bool _isCreation) const
+{
+	yulAssert(_object.debugData, "");
+
+	// The optimizer only sees the code of the object itself and the names of the data it can access.
+	// All debug info is included, because it ends up in the optimized code.
+	std::string key = _isCreation ? "creation\n" : "deployed\n";
+	for (YulString const& name: _object.qualifiedDataNames())
+		key += name.str() + "\n";
+	key += AsmPrinter(
+		languageToDialect(m_language, m_qrvmVersion),
+		_object.debugData->sourceNames,
+		DebugInfoSelection::All()
+	)(*_object.code);
+	return util::keccak256(key);
+}
+
+util::h256 YulStack::persistentOptimizedCodeCacheKey(Object const& _object, util::h256 const& _cacheKey) const
+{
+	yulAssert(_object.debugData && _object.debugData->sourceNames, "");
+
+	// Within a compilation the settings are fixed and source indices always refer to the same
+	// source, which is not the case for later ones.
+	std::string key = _cacheKey.hex() + "\n";
+	key += std::to_string(static_cast<int>(m_language)) + "\n";
+	key += m_qrvmVersion.name() + "\n";
+	key += m_optimiserSettings.runYulOptimiser ? "yul\n" : "no-yul\n";
+	key += m_optimiserSettings.optimizeStackAllocation ? "stack\n" : "no-stack\n";
+	key += m_optimiserSettings.yulOptimiserSteps + ":" + m_optimiserSettings.yulOptimiserCleanupSteps + "\n";
+	key += std::to_string(m_optimiserSettings.yulOptimiserMinRoundGain) + "\n";
+	key += std::to_string(m_optimiserSettings.expectedExecutionsPerDeployment) + "\n";
+	for (auto const& [index, name]: *_object.debugData->sourceNames)
+		key += std::to_string(index) + ":" + *name + "\n";
+	return util::keccak256(key);
+}
+
+std::shared_ptr<Block> YulStack::parseOptimizedCode(Object const& _object, std::string const& _code) const
+{
+	ErrorList errors;
+	ErrorReporter errorReporter(errors);
+	CharStream charStream(_code, "");
+	std::shared_ptr<Block> code = Parser(
+		errorReporter,
+		languageToDialect(m_language, m_qrvmVersion),
+		_object.debugData->sourceNames
+	).parse(charStream);
+	yulAssert(code && !errorReporter.hasErrors(), "Invalid code in the persistent optimized code cache.");
+	return code;
 }
 
 MachineAssemblyObject YulStack::assemble(Machine _machine) const
@@ -33,8 +33,11 @@
 
 #include <libqrvmasm/LinkerObject.h>
 
+#include <libhyputil/FixedHash.h>
+
 #include <json/json.h>
 
+#include <map>
 #include <memory>
 #include <string>
 
@@ -53,6 +56,28 @@ namespace hyperion::yul
 class AbstractAssembly;
 
 
+/// Printed optimized code of Yul objects. Unlike OptimizedCodeCache it does not refer to any
+/// YulString, so it stays valid across compilations and can be kept by a long-running process.
+/// The keys also cover the settings, so it can be shared by stacks with different settings.
+struct PersistentOptimizedCodeCache
+{
+	/// Optimized code, keyed by a hash of the unoptimized code and everything else the result depends on.
+	std::map<util::h256, std::string> code;
+	/// Total length of the cached code. The cache is cleared when it would exceed @a maxSize.
+	size_t size = 0;
+	size_t maxSize = 256 * 1024 * 1024;
+};
+
+/// Optimized code of Yul objects. It can be shared by stacks with identical settings, so that
+/// an object embedded into several others (e.g. a contract created with ``new``) is optimized once.
+struct OptimizedCodeCache
+{
+	/// Optimized code, keyed by a hash of the unoptimized code and everything else the result depends on.
+	std::map<util::h256, std::shared_ptr<Block>> code;
+	/// Optional second level consulted on misses, which outlives the compilation.
+	std::shared_ptr<PersistentOptimizedCodeCache> persistent;
+};
+
 struct MachineAssemblyObject
 {
 	std::shared_ptr<qrvmasm::LinkerObject> bytecode;
@@ -82,12 +107,14 @@ public:
 		langutil::QRVMVersion _qrvmVersion,
 		Language _language,
 		hyperion::frontend::OptimiserSettings _optimiserSettings,
-		langutil::DebugInfoSelection const& _debugInfoSelection
+		langutil::DebugInfoSelection const& _debugInfoSelection,
+		std::shared_ptr<OptimizedCodeCache> _optimizedCodeCache = {}
 	):
 		m_language(_language),
 		m_qrvmVersion(_qrvmVersion),
 		m_optimiserSettings(std::move(_optimiserSettings)),
 		m_debugInfoSelection(_debugInfoSelection),
+		m_optimizedCodeCache(std::move(_optimizedCodeCache)),
 		m_errorReporter(m_errors)
 	{}
 
@@ -100,6 +127,8 @@ public:
 
 	/// Run the optimizer suite. Can only be used with Yul or strict assembly.
 	/// If the settings (see constructor) disabled the optimizer, nothing is done here.
+	/// The optimized code cache is released afterwards, so that a stack kept for its
+	/// outputs does not keep the code of other objects alive.
 	void optimize();
 
 	/// Run the assembly step (should only be called after parseAndAnalyze).
@@ -140,11 +169,19 @@ private:
 	void compileQRVM(yul::AbstractAssembly& _assembly, bool _optimize) const;
 
 	void optimize(yul::Object& _object, bool _isCreation);
+	/// @returns the key of the optimized code of @a _object in the optimized code cache.
+	util::h256 optimizedCodeCacheKey(yul::Object const& _object, bool _isCreation) const;
+	/// @returns the key of @a _object in the persistent cache, which in addition to @a _cacheKey
+	/// covers everything that does not stay the same across compilations.
+	util::h256 persistentOptimizedCodeCacheKey(yul::Object const& _object, util::h256 const& _cacheKey) const;
+	/// Parses optimized code of @a _object taken from the persistent cache.
+	std::shared_ptr<Block> parseOptimizedCode(yul::Object const& _object, std::string const& _code) const;
 
 	Language m_language = Language::Assembly;
 	langutil::QRVMVersion m_qrvmVersion;
 	hyperion::frontend::OptimiserSettings m_optimiserSettings;
 	langutil::DebugInfoSelection m_debugInfoSelection{};
+	std::shared_ptr<OptimizedCodeCache> m_optimizedCodeCache;
 
 	std::unique_ptr<langutil::CharStream> m_charStream;
 
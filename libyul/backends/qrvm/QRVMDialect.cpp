@@ -51,7 +51,7 @@ std::pair<YulString, BuiltinFunctionForQRVM> createQRVMFunction(
 	qrvmasm::Instruction _instruction
 )
 {
-	qrvmasm::InstructionInfo info = qrvmasm::instructionInfo(_instruction);
+	qrvmasm::InstructionInfo const& info = qrvmasm::instructionInfo(_instruction);
 	BuiltinFunctionForQRVM f;
 	f.name = YulString{_name};
 	f.parameters.resize(static_cast<size_t>(info.args));
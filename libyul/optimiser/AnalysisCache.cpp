@@ -0,0 +1,89 @@
+/*
+	This file is part of hyperion.
+
+	hyperion is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	hyperion is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with hyperion.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Cache for whole-program analyses shared between optimiser steps.
+ */
+
+#include <libyul/optimiser/AnalysisCache.h>
+
+#include <libyul/optimiser/Semantics.h>
+#include <libyul/ControlFlowSideEffectsCollector.h>
+#include <libyul/Exceptions.h>
+
+using namespace hyperion;
+using namespace hyperion::yul;
+
+CallGraph const& AnalysisCache::callGraph(Block const& _ast)
+{
+	if (!usable(m_callGraph, _ast))
+		m_callGraph = CallGraphGenerator::callGraph(_ast);
+	return *m_callGraph;
+}
+
+std::map<YulString, SideEffects> const& AnalysisCache::functionSideEffects(
+	Dialect const& _dialect,
+	Block const& _ast
+)
+{
+	if (!usable(m_functionSideEffects, _ast))
+		m_functionSideEffects = SideEffectsPropagator::sideEffects(_dialect, callGraph(_ast));
+	return *m_functionSideEffects;
+}
+
+std::map<YulString, ControlFlowSideEffects> const& AnalysisCache::controlFlowSideEffects(
+	Dialect const& _dialect,
+	Block const& _ast
+)
+{
+	if (!usable(m_controlFlowSideEffects, _ast))
+		m_controlFlowSideEffects = ControlFlowSideEffectsCollector{_dialect, _ast}.functionSideEffectsNamed();
+	return *m_controlFlowSideEffects;
+}
+
+bool AnalysisCache::containsMSize(Dialect const& _dialect, Block const& _ast)
+{
+	if (!usable(m_containsMSize, _ast))
+		m_containsMSize = MSizeFinder::containsMSize(_dialect, _ast);
+	return *m_containsMSize;
+}
+
+void AnalysisCache::invalidate()
+{
+	m_ast = nullptr;
+	m_callGraph.reset();
+	m_functionSideEffects.reset();
+	m_controlFlowSideEffects.reset();
+	m_containsMSize.reset();
+}
+
+void AnalysisCache::setEnabled(bool _enabled)
+{
+	m_enabled = _enabled;
+	invalidate();
+}
+
+template <typename T>
+bool AnalysisCache::usable(std::optional<T> const& _result, Block const& _ast)
+{
+	if (!m_enabled)
+		return false;
+	if (!m_ast)
+		m_ast = &_ast;
+	yulAssert(m_ast == &_ast, "Analysis cache used for different ASTs without invalidation.");
+	return _result.has_value();
+}
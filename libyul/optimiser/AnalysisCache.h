@@ -0,0 +1,80 @@
+/*
+	This file is part of hyperion.
+
+	hyperion is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	hyperion is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with hyperion.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Cache for whole-program analyses shared between optimiser steps.
+ */
+
+#pragma once
+
+#include <libyul/optimiser/CallGraphGenerator.h>
+#include <libyul/ControlFlowSideEffects.h>
+#include <libyul/SideEffects.h>
+#include <libyul/YulString.h>
+
+#include <map>
+#include <optional>
+
+namespace hyperion::yul
+{
+
+struct Dialect;
+
+/**
+ * Cache for the results of whole-program analyses (call graph, side effects of functions,
+ * control-flow side effects of functions and use of msize) that many optimiser steps need.
+ *
+ * While disabled, which is the default, every query recomputes its result.
+ * The optimiser suite enables the cache while it runs a sequence of steps and invalidates
+ * it after every step that does not declare to maintain it (see OptimiserStep).
+ * Steps that do so have to call ``invalidate`` themselves whenever they change the code
+ * in a way that can affect any of the analyses.
+ *
+ * All queries have to refer to the same AST until the cache is invalidated.
+ */
+class AnalysisCache
+{
+public:
+	CallGraph const& callGraph(Block const& _ast);
+	std::map<YulString, SideEffects> const& functionSideEffects(Dialect const& _dialect, Block const& _ast);
+	std::map<YulString, ControlFlowSideEffects> const& controlFlowSideEffects(
+		Dialect const& _dialect,
+		Block const& _ast
+	);
+	bool containsMSize(Dialect const& _dialect, Block const& _ast);
+
+	/// Discards all cached results.
+	void invalidate();
+	/// Enables or disables caching. Discards all cached results in both cases.
+	void setEnabled(bool _enabled);
+	bool enabled() const { return m_enabled; }
+
+private:
+	/// @returns true if the cached result @a _result can be used for @a _ast.
+	template <typename T>
+	bool usable(std::optional<T> const& _result, Block const& _ast);
+
+	bool m_enabled = false;
+	/// The AST the cached results belong to.
+	Block const* m_ast = nullptr;
+	std::optional<CallGraph> m_callGraph;
+	std::optional<std::map<YulString, SideEffects>> m_functionSideEffects;
+	std::optional<std::map<YulString, ControlFlowSideEffects>> m_controlFlowSideEffects;
+	std::optional<bool> m_containsMSize;
+};
+
+}
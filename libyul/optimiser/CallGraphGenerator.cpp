@@ -23,7 +23,10 @@
 #include <libyul/optimiser/CallGraphGenerator.h>
 
 #include <libhyputil/CommonData.h>
-#include <stack>
+
+#include <algorithm>
+#include <map>
+#include <vector>
 
 using namespace hyperion;
 using namespace hyperion::yul;
@@ -31,31 +34,50 @@ using namespace hyperion::util;
 
 namespace
 {
-// TODO: This algorithm is non-optimal.
+/// Finds the functions on cycles of the call graph as the strongly connected components
+/// with more than one function, plus the functions that call themselves (Tarjan's algorithm).
 struct CallGraphCycleFinder
 {
 	CallGraph const& callGraph;
 	std::set<YulString> containedInCycle{};
-	std::set<YulString> visited{};
-	std::vector<YulString> currentPath{};
+	std::map<YulString, size_t> index{};
+	std::map<YulString, size_t> lowLink{};
+	std::vector<YulString> stack{};
+	std::set<YulString> onStack{};
 
 	void visit(YulString _function)
 	{
-		if (visited.count(_function))
+		if (index.count(_function))
 			return;
-		if (
-			auto it = find(currentPath.begin(), currentPath.end(), _function);
-			it != currentPath.end()
-		)
-			containedInCycle.insert(it, currentPath.end());
-		else
+		size_t const functionIndex = index.size();
+		index[_function] = functionIndex;
+		lowLink[_function] = functionIndex;
+		stack.emplace_back(_function);
+		onStack.insert(_function);
+
+		if (auto const* callees = valueOrNullptr(callGraph.functionCalls, _function))
+			for (YulString callee: *callees)
+			{
+				if (callee == _function)
+					containedInCycle.insert(_function);
+				if (!index.count(callee))
+				{
+					visit(callee);
+					lowLink[_function] = std::min(lowLink[_function], lowLink[callee]);
+				}
+				else if (onStack.count(callee))
+					lowLink[_function] = std::min(lowLink[_function], index[callee]);
+			}
+
+		if (lowLink[_function] == functionIndex)
 		{
-			currentPath.emplace_back(_function);
-			if (callGraph.functionCalls.count(_function))
-				for (auto const& child: callGraph.functionCalls.at(_function))
-					visit(child);
-			currentPath.pop_back();
-			visited.insert(_function);
+			// _function is the root of a component consisting of everything above it on the stack.
+			auto componentBegin = std::find(stack.begin(), stack.end(), _function);
+			if (stack.end() - componentBegin > 1)
+				containedInCycle.insert(componentBegin, stack.end());
+			for (auto it = componentBegin; it != stack.end(); ++it)
+				onStack.erase(*it);
+			stack.erase(componentBegin, stack.end());
 		}
 	}
 };
@@ -19,7 +19,6 @@
 #include <libyul/optimiser/Semantics.h>
 #include <libyul/AST.h>
 #include <libyul/optimiser/NameCollector.h>
-#include <libyul/ControlFlowSideEffectsCollector.h>
 #include <libhyputil/CommonData.h>
 
 using namespace hyperion;
@@ -30,7 +29,7 @@ void ConditionalSimplifier::run(OptimiserStepContext& _context, Block& _ast)
 {
 	ConditionalSimplifier{
 		_context.dialect,
-		ControlFlowSideEffectsCollector{_context.dialect, _ast}.functionSideEffectsNamed()
+		_context.analyses.controlFlowSideEffects(_context.dialect, _ast)
 	}(_ast);
 }
 
@@ -22,7 +22,6 @@
 
 #include <libyul/optimiser/EqualStoreEliminator.h>
 
-#include <libyul/optimiser/CallGraphGenerator.h>
 #include <libyul/optimiser/OptimizerUtilities.h>
 #include <libyul/optimiser/Semantics.h>
 #include <libyul/AST.h>
@@ -33,16 +32,19 @@ using namespace hyperion::util;
 using namespace hyperion::qrvmasm;
 using namespace hyperion::yul;
 
-void EqualStoreEliminator::run(OptimiserStepContext const& _context, Block& _ast)
+void EqualStoreEliminator::run(OptimiserStepContext& _context, Block& _ast)
 {
 	EqualStoreEliminator eliminator{
 		_context.dialect,
-		SideEffectsPropagator::sideEffects(_context.dialect, CallGraphGenerator::callGraph(_ast))
+		_context.analyses.functionSideEffects(_context.dialect, _ast)
 	};
 	eliminator(_ast);
 
+	if (eliminator.m_pendingRemovals.empty())
+		return;
 	StatementRemover remover{eliminator.m_pendingRemovals};
 	remover(_ast);
+	_context.analyses.invalidate();
 }
 
 void EqualStoreEliminator::visit(Statement& _statement)
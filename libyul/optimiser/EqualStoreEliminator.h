@@ -40,7 +40,9 @@ class EqualStoreEliminator: public DataFlowAnalyzer
 {
 public:
 	static constexpr char const* name{"EqualStoreEliminator"};
-	static void run(OptimiserStepContext const&, Block& _ast);
+	static void run(OptimiserStepContext&, Block& _ast);
+	/// Invalidates the analyses cached in the context only if it removes a store.
+	static constexpr bool maintainsAnalyses = true;
 
 private:
 	EqualStoreEliminator(
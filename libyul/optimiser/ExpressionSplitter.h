@@ -61,6 +61,9 @@ class ExpressionSplitter: public ASTModifier
 public:
 	static constexpr char const* name{"ExpressionSplitter"};
 	static void run(OptimiserStepContext&, Block& _ast);
+	/// Only moves expressions into new variables without changing the order of evaluation,
+	/// which does not affect the analyses cached in the context.
+	static constexpr bool maintainsAnalyses = true;
 
 	void operator()(FunctionCall&) override;
 	void operator()(If&) override;
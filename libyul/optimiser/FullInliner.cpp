@@ -254,6 +254,11 @@ void FullInliner::handleBlock(YulString _currentFunctionName, Block& _block)
 
 bool FullInliner::recursive(FunctionDefinition const& _fun) const
 {
+	// Inlining only copies calls that were reachable before, so a function can only end up
+	// calling itself if it was on a cycle of the original call graph. This avoids walking
+	// the body of the called function for every call site.
+	if (!m_recursiveFunctions.count(_fun.name))
+		return false;
 	std::map<YulString, size_t> references = ReferencesCounter::countReferences(_fun);
 	return references[_fun.name] > 0;
 }
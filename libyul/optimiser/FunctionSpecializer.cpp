@@ -127,7 +127,7 @@ FunctionDefinition FunctionSpecializer::specialize(
 void FunctionSpecializer::run(OptimiserStepContext& _context, Block& _ast)
 {
 	FunctionSpecializer f{
-		CallGraphGenerator::callGraph(_ast).recursiveFunctions(),
+		_context.analyses.callGraph(_ast).recursiveFunctions(),
 		_context.dispenser,
 		_context.dialect
 	};
@@ -25,7 +25,6 @@
 #include <libyul/backends/qrvm/QRVMDialect.h>
 #include <libyul/backends/qrvm/QRVMMetrics.h>
 #include <libyul/optimiser/Semantics.h>
-#include <libyul/optimiser/CallGraphGenerator.h>
 #include <libyul/optimiser/OptimizerUtilities.h>
 #include <libyul/SideEffects.h>
 #include <libyul/AST.h>
@@ -44,10 +43,10 @@ using namespace hyperion::yul;
 
 void LoadResolver::run(OptimiserStepContext& _context, Block& _ast)
 {
-	bool containsMSize = MSizeFinder::containsMSize(_context.dialect, _ast);
+	bool containsMSize = _context.analyses.containsMSize(_context.dialect, _ast);
 	LoadResolver{
 		_context.dialect,
-		SideEffectsPropagator::sideEffects(_context.dialect, CallGraphGenerator::callGraph(_ast)),
+		_context.analyses.functionSideEffects(_context.dialect, _ast),
 		containsMSize,
 		_context.expectedExecutionsPerDeployment
 	}(_ast);
@@ -18,7 +18,6 @@
 
 #include <libyul/optimiser/LoopInvariantCodeMotion.h>
 
-#include <libyul/optimiser/CallGraphGenerator.h>
 #include <libyul/optimiser/NameCollector.h>
 #include <libyul/optimiser/Semantics.h>
 #include <libyul/optimiser/SSAValueTracker.h>
@@ -32,9 +31,9 @@ using namespace hyperion::yul;
 
 void LoopInvariantCodeMotion::run(OptimiserStepContext& _context, Block& _ast)
 {
-	std::map<YulString, SideEffects> functionSideEffects =
-		SideEffectsPropagator::sideEffects(_context.dialect, CallGraphGenerator::callGraph(_ast));
-	bool containsMSize = MSizeFinder::containsMSize(_context.dialect, _ast);
+	std::map<YulString, SideEffects> const& functionSideEffects =
+		_context.analyses.functionSideEffects(_context.dialect, _ast);
+	bool containsMSize = _context.analyses.containsMSize(_context.dialect, _ast);
 	std::set<YulString> ssaVars = SSAValueTracker::ssaVariables(_ast);
 	LoopInvariantCodeMotion{_context.dialect, ssaVars, functionSideEffects, containsMSize}(_ast);
 }
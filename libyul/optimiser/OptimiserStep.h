@@ -18,6 +18,7 @@
 
 #pragma once
 
+#include <libyul/optimiser/AnalysisCache.h>
 #include <libyul/Exceptions.h>
 
 #include <optional>
@@ -39,6 +40,8 @@ struct OptimiserStepContext
 	std::set<YulString> const& reservedIdentifiers;
 	/// The value nullopt represents creation code
 	std::optional<size_t> expectedExecutionsPerDeployment;
+	/// Whole-program analyses shared between steps.
+	AnalysisCache analyses{};
 };
 
 
@@ -56,6 +59,10 @@ struct OptimiserStep
 	/// an SMT solver to be loaded, but none is available. In that case, the string
 	/// contains a human-readable reason.
 	virtual std::optional<std::string> invalidInCurrentEnvironment() const = 0;
+	/// @returns true if the step invalidates the analyses cached in the context itself
+	/// whenever it changes the code in a way that affects them. Otherwise, they are
+	/// invalidated after every run of the step.
+	virtual bool maintainsAnalyses() const = 0;
 	std::string name;
 };
 
@@ -74,6 +81,17 @@ private:
 		static constexpr bool value = decltype(test<T>(0))::value;
 	};
 
+	template<typename T>
+	struct MaintainsAnalyses
+	{
+	private:
+		template<typename U> static auto test(int) -> std::bool_constant<U::maintainsAnalyses>;
+		template<typename> static std::false_type test(...);
+
+	public:
+		static constexpr bool value = decltype(test<T>(0))::value;
+	};
+
 public:
 	OptimiserStepInstance(): OptimiserStep{Step::name} {}
 	void run(OptimiserStepContext& _context, Block& _ast) const override
@@ -87,6 +105,10 @@ public:
 		else
 			return std::nullopt;
 	}
+	bool maintainsAnalyses() const override
+	{
+		return MaintainsAnalyses<Step>::value;
+	}
 };
 
 
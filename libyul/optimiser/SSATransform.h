@@ -93,6 +93,9 @@ class SSATransform: public ASTModifier
 public:
 	static constexpr char const* name{"SSATransform"};
 	static void run(OptimiserStepContext& _context, Block& _ast);
+	/// Only introduces new variables and assignments between variables,
+	/// which does not affect the analyses cached in the context.
+	static constexpr bool maintainsAnalyses = true;
 };
 
 }
@@ -79,6 +79,7 @@
 #include <range/v3/action/remove.hpp>
 
 #include <limits>
+#include <optional>
 #include <tuple>
 
 #ifdef PROFILE_OPTIMIZER_STEPS
@@ -139,9 +140,11 @@ void OptimiserSuite::run(
 	std::string_view _optimisationSequence,
 	std::string_view _optimisationCleanupSequence,
 	std::optional<size_t> _expectedExecutionsPerDeployment,
-	std::set<YulString> const& _externallyUsedIdentifiers
+	std::set<YulString> const& _externallyUsedIdentifiers,
+	size_t _minRoundGain
 )
 {
+	yulAssert(_minRoundGain <= 100, "");
 	QRVMDialect const* qrvmDialect = dynamic_cast<QRVMDialect const*>(&_dialect);
 	bool usesOptimizedCodeGenerator =
 		_optimizeStackAllocation &&
@@ -160,7 +163,7 @@ void OptimiserSuite::run(
 	NameDispenser dispenser{_dialect, ast, reservedIdentifiers};
 	OptimiserStepContext context{_dialect, dispenser, reservedIdentifiers, _expectedExecutionsPerDeployment};
 
-	OptimiserSuite suite(context, Debug::None);
+	OptimiserSuite suite(context, Debug::None, _minRoundGain);
 
 	// Some steps depend on properties ensured by FunctionHoister, BlockFlattener, FunctionGrouper and
 	// ForLoopInitRewriter. Run them first to be able to run arbitrary sequences safely.
@@ -472,6 +475,10 @@ void OptimiserSuite::runSequence(std::string_view _stepAbbreviations, Block& _as
 	}
 
 	size_t codeSize = 0;
+	// Only measured if rounds can stop early or are reported, so that the default stays unchanged.
+	std::optional<size_t> sizeBeforeRound;
+	if (_repeatUntilStable && (m_minRoundGain > 0 || m_debug != Debug::None))
+		sizeBeforeRound = CodeSize::codeSizeIncludingFunctions(_ast);
 	for (size_t round = 0; round < MaxRounds; ++round)
 	{
 		for (auto const& [subsequence, repeat]: subsequences)
@@ -486,6 +493,21 @@ void OptimiserSuite::runSequence(std::string_view _stepAbbreviations, Block& _as
 			break;
 
 		size_t newSize = CodeSize::codeSizeIncludingFunctions(_ast);
+		if (sizeBeforeRound)
+		{
+			if (m_debug != Debug::None)
+				std::cout <<
+					"Round " << round + 1 << " of [" << _stepAbbreviations << "]: " <<
+					"code size " << *sizeBeforeRound << " -> " << newSize << std::endl;
+			// Stops if the code shrank by less than m_minRoundGain percent (or grew).
+			if (m_minRoundGain > 0 && newSize * 100 > *sizeBeforeRound * (100 - m_minRoundGain))
+			{
+				if (m_debug != Debug::None)
+					std::cout << "Gain below " << m_minRoundGain << "%, no further rounds." << std::endl;
+				break;
+			}
+			sizeBeforeRound = newSize;
+		}
 		if (newSize == codeSize)
 			break;
 		codeSize = newSize;
@@ -497,6 +519,10 @@ void OptimiserSuite::runSequence(std::vector<std::string> const& _steps, Block&
 	std::unique_ptr<Block> copy;
 	if (m_debug == Debug::PrintChanges)
 		copy = std::make_unique<Block>(std::get<Block>(ASTCopier{}(_ast)));
+	// The code may be changed outside of the steps, so the analyses are only shared
+	// between the steps of the sequence.
+	m_context.analyses.setEnabled(true);
+	ScopeGuard disableAnalyses([&]() { m_context.analyses.setEnabled(false); });
 	for (std::string const& step: _steps)
 	{
 		if (m_debug == Debug::PrintStep)
@@ -504,7 +530,10 @@ void OptimiserSuite::runSequence(std::vector<std::string> const& _steps, Block&
 #ifdef PROFILE_OPTIMIZER_STEPS
 		steady_clock::time_point startTime = steady_clock::now();
 #endif
-		allSteps().at(step)->run(m_context, _ast);
+		OptimiserStep const& optimiserStep = *allSteps().at(step);
+		optimiserStep.run(m_context, _ast);
+		if (!optimiserStep.maintainsAnalyses())
+			m_context.analyses.invalidate();
 #ifdef PROFILE_OPTIMIZER_STEPS
 		steady_clock::time_point endTime = steady_clock::now();
 		m_durationPerStepInMicroseconds[step] += duration_cast<microseconds>(endTime - startTime).count();
@@ -59,7 +59,13 @@ public:
 		PrintStep,
 		PrintChanges
 	};
-	OptimiserSuite(OptimiserStepContext& _context, Debug _debug = Debug::None): m_context(_context), m_debug(_debug) {}
+	/// @param _minRoundGain minimum code size reduction in percent for another round of a
+	/// repeated part of a sequence, zero to repeat until the code size no longer changes.
+	OptimiserSuite(OptimiserStepContext& _context, Debug _debug = Debug::None, size_t _minRoundGain = 0):
+		m_context(_context),
+		m_debug(_debug),
+		m_minRoundGain(_minRoundGain)
+	{}
 
 	/// The value nullopt for `_expectedExecutionsPerDeployment` represents creation code.
 	static void run(
@@ -70,7 +76,8 @@ public:
 		std::string_view _optimisationSequence,
 		std::string_view _optimisationCleanupSequence,
 		std::optional<size_t> _expectedExecutionsPerDeployment,
-		std::set<YulString> const& _externallyUsedIdentifiers = {}
+		std::set<YulString> const& _externallyUsedIdentifiers = {},
+		size_t _minRoundGain = 0
 	);
 
 	/// Ensures that specified sequence of step abbreviations is well-formed and can be executed.
@@ -91,6 +98,7 @@ public:
 private:
 	OptimiserStepContext& m_context;
 	Debug m_debug;
+	size_t m_minRoundGain = 0;
 #ifdef PROFILE_OPTIMIZER_STEPS
 	std::map<std::string, int64_t> m_durationPerStepInMicroseconds;
 #endif
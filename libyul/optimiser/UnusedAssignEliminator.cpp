@@ -24,7 +24,6 @@
 
 #include <libyul/optimiser/Semantics.h>
 #include <libyul/optimiser/OptimizerUtilities.h>
-#include <libyul/ControlFlowSideEffectsCollector.h>
 #include <libyul/AST.h>
 #include <libyul/AsmPrinter.h>
 
@@ -41,15 +40,18 @@ void UnusedAssignEliminator::run(OptimiserStepContext& _context, Block& _ast)
 {
 	UnusedAssignEliminator uae{
 		_context.dialect,
-		ControlFlowSideEffectsCollector{_context.dialect, _ast}.functionSideEffectsNamed()
+		_context.analyses.controlFlowSideEffects(_context.dialect, _ast)
 	};
 	uae(_ast);
 
-	uae.m_storesToRemove += uae.m_allStores - uae.m_usedStores;
+	uae.collectUnusedStores();
 
+	if (uae.m_storesToRemove.empty())
+		return;
 	std::set<Statement const*> toRemove{uae.m_storesToRemove.begin(), uae.m_storesToRemove.end()};
 	StatementRemover remover{toRemove};
 	remover(_ast);
+	_context.analyses.invalidate();
 }
 
 void UnusedAssignEliminator::operator()(Identifier const& _identifier)
@@ -67,6 +69,7 @@ void UnusedAssignEliminator::operator()(Assignment const& _assignment)
 void UnusedAssignEliminator::operator()(FunctionDefinition const& _functionDefinition)
 {
 	ScopedSaveAndRestore outerReturnVariables(m_returnVariables, {});
+	ScopedSaveAndRestore outerVariableStores(m_variableStores, {});
 
 	for (auto const& retParam: _functionDefinition.returnVariables)
 		m_returnVariables.insert(retParam.name);
@@ -104,7 +107,7 @@ void UnusedAssignEliminator::operator()(Block const& _block)
 	for (auto const& statement: _block.statements)
 		if (auto const* varDecl = std::get_if<VariableDeclaration>(&statement))
 			for (auto const& var: varDecl->variables)
-				m_activeStores.erase(var.name);
+				clearActive(var.name);
 }
 
 void UnusedAssignEliminator::visit(Statement const& _statement)
@@ -117,13 +120,20 @@ void UnusedAssignEliminator::visit(Statement const& _statement)
 		// but clear the active stores to the assigned variables in any case.
 		if (SideEffectsCollector{m_dialect, *assignment->value}.movable())
 		{
-			m_allStores.insert(&_statement);
-			for (auto const& var: assignment->variableNames)
-				m_activeStores[var.name] = {&_statement};
+			bool const newStatement = !m_storeIndices.count(&_statement);
+			size_t const firstStore = storeIndex(_statement, assignment->variableNames.size());
+			for (size_t i = 0; i < assignment->variableNames.size(); ++i)
+			{
+				YulString variable = assignment->variableNames[i].name;
+				if (newStatement)
+					m_variableStores[variable].emplace_back(firstStore + i);
+				clearActive(variable);
+				m_activeStores.insert(firstStore + i);
+			}
 		}
 		else
 			for (auto const& var: assignment->variableNames)
-				m_activeStores[var.name].clear();
+				clearActive(var.name);
 	}
 }
 
@@ -134,16 +144,9 @@ void UnusedAssignEliminator::shortcutNestedLoop(ActiveStores const& _zeroRuns)
 	// We do not have to do that with the "break" or "continue" paths, because
 	// they will be joined later anyway.
 
-	for (auto& [variable, stores]: m_activeStores)
-	{
-		auto zeroIt = _zeroRuns.find(variable);
-		for (auto& assignment: stores)
-		{
-			if (zeroIt != _zeroRuns.end() && zeroIt->second.count(assignment))
-				continue;
-			m_usedStores.insert(assignment);
-		}
-	}
+	ActiveStores newStores = m_activeStores;
+	newStores -= _zeroRuns;
+	m_usedStores += newStores;
 }
 
 void UnusedAssignEliminator::finalizeFunctionDefinition(FunctionDefinition const& _functionDefinition)
@@ -154,7 +157,18 @@ void UnusedAssignEliminator::finalizeFunctionDefinition(FunctionDefinition const
 
 void UnusedAssignEliminator::markUsed(YulString _variable)
 {
-	for (auto& assignment: m_activeStores[_variable])
-		m_usedStores.insert(assignment);
-	m_activeStores.erase(_variable);
+	if (auto const* stores = util::valueOrNullptr(m_variableStores, _variable))
+		for (size_t store: *stores)
+			if (m_activeStores.contains(store))
+			{
+				m_usedStores.insert(store);
+				m_activeStores.erase(store);
+			}
+}
+
+void UnusedAssignEliminator::clearActive(YulString _variable)
+{
+	if (auto const* stores = util::valueOrNullptr(m_variableStores, _variable))
+		for (size_t store: *stores)
+			m_activeStores.erase(store);
 }
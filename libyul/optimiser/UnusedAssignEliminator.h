@@ -118,6 +118,8 @@ class UnusedAssignEliminator: public UnusedStoreBase
 public:
 	static constexpr char const* name{"UnusedAssignEliminator"};
 	static void run(OptimiserStepContext&, Block& _ast);
+	/// Invalidates the analyses cached in the context only if it removes an assignment.
+	static constexpr bool maintainsAnalyses = true;
 
 	explicit UnusedAssignEliminator(
 		Dialect const& _dialect,
@@ -142,8 +144,12 @@ private:
 	void finalizeFunctionDefinition(FunctionDefinition const& _functionDefinition) override;
 
 	void markUsed(YulString _variable);
+	/// Removes the active stores to @a _variable without marking them as used.
+	void clearActive(YulString _variable);
 
 	std::set<YulString> m_returnVariables;
+	/// Indices of the stores to each variable (in the current function).
+	std::map<YulString, std::vector<size_t>> m_variableStores;
 	std::map<YulString, ControlFlowSideEffects> m_controlFlowSideEffects;
 };
 
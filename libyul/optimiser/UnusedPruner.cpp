@@ -35,7 +35,16 @@ using namespace hyperion::yul;
 
 void UnusedPruner::run(OptimiserStepContext& _context, Block& _ast)
 {
-	UnusedPruner::runUntilStabilisedOnFullAST(_context.dialect, _ast, _context.reservedIdentifiers);
+	std::map<YulString, SideEffects> const& functionSideEffects =
+		_context.analyses.functionSideEffects(_context.dialect, _ast);
+	bool allowMSizeOptimization = !_context.analyses.containsMSize(_context.dialect, _ast);
+	runUntilStabilised(
+		_context.dialect,
+		_ast,
+		allowMSizeOptimization,
+		&functionSideEffects,
+		_context.reservedIdentifiers
+	);
 	FunctionGrouper::run(_context, _ast);
 }
 
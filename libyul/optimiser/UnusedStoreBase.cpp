@@ -29,6 +29,8 @@
 
 #include <range/v3/action/remove_if.hpp>
 
+#include <algorithm>
+
 using namespace hyperion;
 using namespace hyperion::yul;
 
@@ -70,7 +72,8 @@ void UnusedStoreBase::operator()(Switch const& _switch)
 
 void UnusedStoreBase::operator()(FunctionDefinition const& _functionDefinition)
 {
-	ScopedSaveAndRestore allStores(m_allStores, {});
+	ScopedSaveAndRestore stores(m_stores, {});
+	ScopedSaveAndRestore storeIndices(m_storeIndices, {});
 	ScopedSaveAndRestore usedStores(m_usedStores, {});
 	ScopedSaveAndRestore outerAssignments(m_activeStores, {});
 	ScopedSaveAndRestore forLoopInfo(m_forLoopInfo, {});
@@ -79,7 +82,7 @@ void UnusedStoreBase::operator()(FunctionDefinition const& _functionDefinition)
 	(*this)(_functionDefinition.body);
 
 	finalizeFunctionDefinition(_functionDefinition);
-	m_storesToRemove += m_allStores - m_usedStores;
+	collectUnusedStores();
 }
 
 void UnusedStoreBase::operator()(ForLoop const& _forLoop)
@@ -144,13 +147,7 @@ void UnusedStoreBase::operator()(Continue const&)
 
 void UnusedStoreBase::merge(ActiveStores& _target, ActiveStores&& _other)
 {
-	util::joinMap(_target, std::move(_other), [](
-		std::set<Statement const*>& _storesHere,
-		std::set<Statement const*>&& _storesThere
-	)
-	{
-		_storesHere += _storesThere;
-	});
+	_target += _other;
 }
 
 void UnusedStoreBase::merge(ActiveStores& _target, std::vector<ActiveStores>&& _source)
@@ -159,3 +156,57 @@ void UnusedStoreBase::merge(ActiveStores& _target, std::vector<ActiveStores>&& _
 		merge(_target, std::move(ts));
 	_source.clear();
 }
+
+size_t UnusedStoreBase::storeIndex(Statement const& _statement, size_t _count)
+{
+	auto [it, inserted] = m_storeIndices.emplace(&_statement, m_stores.size());
+	if (inserted)
+		m_stores.resize(m_stores.size() + _count, &_statement);
+	return it->second;
+}
+
+void UnusedStoreBase::collectUnusedStores()
+{
+	std::set<Statement const*> usedStatements;
+	m_usedStores.forEach([&](size_t _index) { usedStatements.insert(m_stores.at(_index)); });
+	for (auto const& [statement, index]: m_storeIndices)
+		if (!usedStatements.count(statement))
+			m_storesToRemove.emplace_back(statement);
+}
+
+bool UnusedStoreBase::StoreSet::contains(size_t _index) const
+{
+	size_t word = _index / wordBits;
+	return word < m_words.size() && ((m_words[word] >> (_index % wordBits)) & 1) != 0;
+}
+
+void UnusedStoreBase::StoreSet::insert(size_t _index)
+{
+	size_t word = _index / wordBits;
+	if (word >= m_words.size())
+		m_words.resize(word + 1, 0);
+	m_words[word] |= uint64_t(1) << (_index % wordBits);
+}
+
+void UnusedStoreBase::StoreSet::erase(size_t _index)
+{
+	size_t word = _index / wordBits;
+	if (word < m_words.size())
+		m_words[word] &= ~(uint64_t(1) << (_index % wordBits));
+}
+
+UnusedStoreBase::StoreSet& UnusedStoreBase::StoreSet::operator+=(StoreSet const& _other)
+{
+	if (_other.m_words.size() > m_words.size())
+		m_words.resize(_other.m_words.size(), 0);
+	for (size_t i = 0; i < _other.m_words.size(); ++i)
+		m_words[i] |= _other.m_words[i];
+	return *this;
+}
+
+UnusedStoreBase::StoreSet& UnusedStoreBase::StoreSet::operator-=(StoreSet const& _other)
+{
+	for (size_t i = 0; i < std::min(m_words.size(), _other.m_words.size()); ++i)
+		m_words[i] &= ~_other.m_words[i];
+	return *this;
+}
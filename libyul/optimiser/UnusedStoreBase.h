@@ -26,7 +26,10 @@
 
 #include <range/v3/action/remove_if.hpp>
 
+#include <cstdint>
+#include <map>
 #include <variant>
+#include <vector>
 
 
 namespace hyperion::yul
@@ -44,6 +47,9 @@ struct Dialect;
  * or not. Those are split and joined at control-flow forks. Once a store has been deemed
  * used, it is removed from the active set and marked as used and this will never change.
  *
+ * Stores are numbered densely per function (see ``storeIndex``), so that the active and used
+ * sets are bit vectors and the copies and joins at control-flow forks are word-parallel.
+ *
  * Prerequisite: Disambiguator, ForLoopInitRewriter.
  */
 class UnusedStoreBase: public ASTWalker
@@ -60,7 +66,28 @@ public:
 	void operator()(Continue const&) override;
 
 protected:
-	using ActiveStores = std::map<YulString, std::set<Statement const*>>;
+	/// Set of store indices, stored as a bit vector that grows on demand.
+	class StoreSet
+	{
+	public:
+		bool contains(size_t _index) const;
+		void insert(size_t _index);
+		void erase(size_t _index);
+		void clear() { m_words.clear(); }
+		/// Adds all elements of @a _other.
+		StoreSet& operator+=(StoreSet const& _other);
+		/// Removes all elements of @a _other.
+		StoreSet& operator-=(StoreSet const& _other);
+		/// Calls @a _callback for each element in increasing order.
+		/// The callback may erase the element it is called for.
+		template <typename Callback>
+		void forEach(Callback&& _callback) const;
+
+	private:
+		static size_t constexpr wordBits = 64;
+		std::vector<uint64_t> m_words;
+	};
+	using ActiveStores = StoreSet;
 
 	/// This function is called for a loop that is nested too deep to avoid
 	/// horrible runtime and should just resolve the situation in a pragmatic
@@ -76,11 +103,21 @@ protected:
 	static void merge(ActiveStores& _target, ActiveStores&& _source);
 	static void merge(ActiveStores& _target, std::vector<ActiveStores>&& _source);
 
+	/// Registers @a _statement as a statement that performs @a _count stores, unless it has
+	/// already been seen in the current function.
+	/// @returns the index of the first of its stores, the others follow consecutively.
+	size_t storeIndex(Statement const& _statement, size_t _count = 1);
+	/// Appends all statements registered in the current function none of whose stores
+	/// are used to the list of stores to remove.
+	void collectUnusedStores();
+
 	Dialect const& m_dialect;
-	/// Set of all stores encountered during the traversal (in the current function).
-	std::set<Statement const*> m_allStores;
+	/// Statement of each store, by store index (in the current function).
+	std::vector<Statement const*> m_stores;
+	/// Index of the first store of each statement (in the current function).
+	std::map<Statement const*, size_t> m_storeIndices;
 	/// Set of stores that are marked as being used (in the current function).
-	std::set<Statement const*> m_usedStores;
+	StoreSet m_usedStores;
 	/// List of stores that can be removed (globally).
 	std::vector<Statement const*> m_storesToRemove;
 	/// Active (undecided) stores in the current branch.
@@ -98,4 +135,16 @@ protected:
 	size_t m_forLoopNestingDepth = 0;
 };
 
+template <typename Callback>
+void UnusedStoreBase::StoreSet::forEach(Callback&& _callback) const
+{
+	for (size_t wordIndex = 0; wordIndex < m_words.size(); ++wordIndex)
+	{
+		uint64_t word = m_words[wordIndex];
+		for (size_t bit = 0; word != 0; word >>= 1, ++bit)
+			if (word & 1)
+				_callback(wordIndex * wordBits + bit);
+	}
+}
+
 }
@@ -28,7 +28,6 @@
 #include <libyul/optimiser/SSAValueTracker.h>
 #include <libyul/optimiser/DataFlowAnalyzer.h>
 #include <libyul/optimiser/KnowledgeBase.h>
-#include <libyul/ControlFlowSideEffectsCollector.h>
 #include <libyul/AST.h>
 
 #include <libyul/backends/qrvm/QRVMDialect.h>
@@ -53,10 +52,8 @@ static std::string const vmWordBytes{"@ " + std::to_string(VMWordBytes)};
 
 void UnusedStoreEliminator::run(OptimiserStepContext& _context, Block& _ast)
 {
-	std::map<YulString, SideEffects> functionSideEffects = SideEffectsPropagator::sideEffects(
-		_context.dialect,
-		CallGraphGenerator::callGraph(_ast)
-	);
+	std::map<YulString, SideEffects> const& functionSideEffects =
+		_context.analyses.functionSideEffects(_context.dialect, _ast);
 
 	SSAValueTracker ssaValues;
 	ssaValues(_ast);
@@ -72,11 +69,11 @@ void UnusedStoreEliminator::run(OptimiserStepContext& _context, Block& _ast)
 	values[YulString{one}] = AssignedValue{&oneLiteral, {}};
 	values[YulString{vmWordBytes}] = AssignedValue{&vmWordBytesLiteral, {}};
 
-	bool const ignoreMemory = MSizeFinder::containsMSize(_context.dialect, _ast);
+	bool const ignoreMemory = _context.analyses.containsMSize(_context.dialect, _ast);
 	UnusedStoreEliminator rse{
 		_context.dialect,
 		functionSideEffects,
-		ControlFlowSideEffectsCollector{_context.dialect, _ast}.functionSideEffectsNamed(),
+		_context.analyses.controlFlowSideEffects(_context.dialect, _ast),
 		values,
 		ignoreMemory
 	};
@@ -88,11 +85,14 @@ void UnusedStoreEliminator::run(OptimiserStepContext& _context, Block& _ast)
 	else
 		rse.markActiveAsUsed(Location::Memory);
 	rse.markActiveAsUsed(Location::Storage);
-	rse.m_storesToRemove += rse.m_allStores - rse.m_usedStores;
+	rse.collectUnusedStores();
 
+	if (rse.m_storesToRemove.empty())
+		return;
 	std::set<Statement const*> toRemove{rse.m_storesToRemove.begin(), rse.m_storesToRemove.end()};
 	StatementRemover remover{toRemove};
 	remover(_ast);
+	_context.analyses.invalidate();
 }
 
 UnusedStoreEliminator::UnusedStoreEliminator(
@@ -209,14 +209,15 @@ void UnusedStoreEliminator::visit(Statement const& _statement)
 			if (!allowReturndatacopyToBeRemoved)
 				return;
 		}
-		m_allStores.insert(&_statement);
-		std::vector<Operation> operations = operationsFromFunctionCall(*funCall);
-		yulAssert(operations.size() == 1, "");
-		if (operations.front().location == Location::Storage)
-			activeStorageStores().insert(&_statement);
-		else
-			activeMemoryStores().insert(&_statement);
-		m_storeOperations[&_statement] = std::move(operations.front());
+		size_t const store = storeIndex(_statement);
+		if (store == m_storeOperations.size())
+		{
+			std::vector<Operation> operations = operationsFromFunctionCall(*funCall);
+			yulAssert(operations.size() == 1, "");
+			m_storeOperations.emplace_back(std::move(operations.front()));
+		}
+		yulAssert(m_storeOperations.size() == m_stores.size());
+		m_activeStores.insert(store);
 	}
 }
 
@@ -272,28 +273,20 @@ std::vector<UnusedStoreEliminator::Operation> UnusedStoreEliminator::operationsF
 
 void UnusedStoreEliminator::applyOperation(UnusedStoreEliminator::Operation const& _operation)
 {
-	std::set<Statement const*>& active =
-		_operation.location == Location::Storage ?
-		activeStorageStores() :
-		activeMemoryStores();
-
-
-	for (auto it = active.begin(); it != active.end();)
-	{
-		Statement const* statement = *it;
-		Operation const& storeOperation = m_storeOperations.at(statement);
+	m_activeStores.forEach([&](size_t _store) {
+		Operation const& storeOperation = m_storeOperations.at(_store);
+		if (storeOperation.location != _operation.location)
+			return;
 		if (_operation.effect == Effect::Read && !knownUnrelated(storeOperation, _operation))
 		{
 			// This store is read from, mark it as used and remove it from the active set.
-			m_usedStores.insert(statement);
-			it = active.erase(it);
+			m_usedStores.insert(_store);
+			m_activeStores.erase(_store);
 		}
 		else if (_operation.effect == Effect::Write && knownCovered(storeOperation, _operation))
 			// This store is overwritten before being read, remove it from the active set.
-			it = active.erase(it);
-		else
-			++it;
-	}
+			m_activeStores.erase(_store);
+	});
 }
 
 bool UnusedStoreEliminator::knownUnrelated(
@@ -414,23 +407,26 @@ void UnusedStoreEliminator::markActiveAsUsed(
 	std::optional<UnusedStoreEliminator::Location> _onlyLocation
 )
 {
-	if (_onlyLocation == std::nullopt || _onlyLocation == Location::Memory)
-		for (Statement const* statement: activeMemoryStores())
-			m_usedStores.insert(statement);
-	if (_onlyLocation == std::nullopt || _onlyLocation == Location::Storage)
-		for (Statement const* statement: activeStorageStores())
-			m_usedStores.insert(statement);
-	clearActive(_onlyLocation);
+	m_activeStores.forEach([&](size_t _store) {
+		if (_onlyLocation == std::nullopt || _onlyLocation == m_storeOperations.at(_store).location)
+		{
+			m_usedStores.insert(_store);
+			m_activeStores.erase(_store);
+		}
+	});
 }
 
 void UnusedStoreEliminator::clearActive(
 	std::optional<UnusedStoreEliminator::Location> _onlyLocation
 )
 {
-	if (_onlyLocation == std::nullopt || _onlyLocation == Location::Memory)
-		activeMemoryStores() = {};
-	if (_onlyLocation == std::nullopt || _onlyLocation == Location::Storage)
-		activeStorageStores() = {};
+	if (_onlyLocation == std::nullopt)
+		m_activeStores.clear();
+	else
+		m_activeStores.forEach([&](size_t _store) {
+			if (m_storeOperations.at(_store).location == *_onlyLocation)
+				m_activeStores.erase(_store);
+		});
 }
 
 std::optional<YulString> UnusedStoreEliminator::identifierNameIfSSA(Expression const& _expression) const
@@ -61,6 +61,8 @@ class UnusedStoreEliminator: public UnusedStoreBase
 public:
 	static constexpr char const* name{"UnusedStoreEliminator"};
 	static void run(OptimiserStepContext& _context, Block& _ast);
+	/// Invalidates the analyses cached in the context only if it removes a store.
+	static constexpr bool maintainsAnalyses = true;
 
 	explicit UnusedStoreEliminator(
 		Dialect const& _dialect,
@@ -92,9 +94,6 @@ public:
 	};
 
 private:
-	std::set<Statement const*>& activeMemoryStores() { return m_activeStores["m"_yulstring]; }
-	std::set<Statement const*>& activeStorageStores() { return m_activeStores["s"_yulstring]; }
-
 	void shortcutNestedLoop(ActiveStores const&) override
 	{
 		// We might only need to do this for newly introduced stores in the loop.
@@ -120,7 +119,8 @@ private:
 	std::map<YulString, ControlFlowSideEffects> m_controlFlowSideEffects;
 	std::map<YulString, AssignedValue> const& m_ssaValues;
 
-	std::map<Statement const*, Operation> m_storeOperations;
+	/// Operation performed by each store, by store index (in the current function).
+	std::vector<Operation> m_storeOperations;
 
 	KnowledgeBase mutable m_knowledgeBase;
 };
@@ -0,0 +1,37 @@
+#!/usr/bin/env bash
+set -euo pipefail
+
+# shellcheck source=scripts/common.sh
+source "${REPO_ROOT}/scripts/common.sh"
+
+HYPTMPDIR=$(mktemp -d -t "cmdline-test-linking-unresolved-references-and-crlf-XXXXXX")
+cd "$HYPTMPDIR"
+
+cat > x.hyp <<'HYP'
+library L1 { function f() external {} }
+library L2 { function f() external {} }
+contract C { function foo() public { L1.f(); L2.f(); L1.f(); L2.f(); L1.f(); } }
+HYP
+msg_on_error --no-stderr "$HYPC" --bin -o . x.hyp
+L1_ADDRESS=Q00000000000000000000000000000000000000000000000000000000000000000000000000000000000000001234567890123456789012345678901234567890
+L2_ADDRESS=Q00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000987654321098765432109876543210987654321
+
+# Each unresolved library is reported once per file, no matter how often it is referenced.
+cp C.bin D.bin
+"$HYPC" --link C.bin D.bin > /dev/null 2> warnings.txt
+for file in C.bin D.bin
+do
+    [[ $(grep -c "in file \"${file}\" still unresolved." warnings.txt) == 2 ]] ||
+        fail "Expected exactly two unresolved references in ${file}:"$'\n'"$(cat warnings.txt)"
+done
+
+# Hints are also removed if the lines end in "\r\n".
+cp C.bin lf.bin
+sed 's/$/\r/' C.bin > crlf.bin
+grep -q $'\r' crlf.bin
+printf "    "
+msg_on_error "$HYPC" --link --libraries "x.hyp:L1=${L1_ADDRESS},x.hyp:L2=${L2_ADDRESS}" lf.bin crlf.bin
+! grep -q '[/_]' lf.bin
+diff_values "$(cat lf.bin)" "$(cat crlf.bin)"
+
+rm -r "$HYPTMPDIR"
@@ -149,11 +149,12 @@ BOOST_AUTO_TEST_CASE(version)
 
 BOOST_AUTO_TEST_CASE(multiple_input_modes)
 {
-	array<string, 10> inputModeOptions = {
+	array<string, 11> inputModeOptions = {
 		"--help",
 		"--license",
 		"--version",
 		"--standard-json",
+		"--standard-json-server",
 		"--link",
 		"--assemble",
 		"--strict-assembly",
@@ -163,7 +164,7 @@ BOOST_AUTO_TEST_CASE(multiple_input_modes)
 	};
 	string expectedMessage =
 		"The following options are mutually exclusive: "
-		"--help, --license, --version, --standard-json, --link, --assemble, --strict-assembly, --yul, --import-ast, --lsp, --import-asm-json. "
+		"--help, --license, --version, --standard-json, --standard-json-server, --link, --assemble, --strict-assembly, --yul, --import-ast, --lsp, --import-asm-json. "
 		"Select at most one.";
 
 	for (string const& mode1: inputModeOptions)
@@ -421,6 +422,49 @@ BOOST_AUTO_TEST_CASE(standard_json_remapping)
 	);
 }
 
+BOOST_AUTO_TEST_CASE(standard_json_server_input_files)
+{
+	string expectedMessage =
+		"Input files are not accepted in --standard-json-server mode.\n"
+		"Requests are read from standard input.";
+
+	for (string const& input: {"input.json", "-"})
+		BOOST_CHECK_EXCEPTION(
+			parseCommandLineAndReadInputFiles({"hypc", "--standard-json-server", input}),
+			CommandLineValidationError,
+			[&](auto const& _exception) { BOOST_TEST(_exception.what() == expectedMessage); return true; }
+		);
+}
+
+BOOST_AUTO_TEST_CASE(standard_json_server)
+{
+	vector<string> requests = {
+		R"({"language": "Hyperion", "sources": {"A.hyp": {"content": "contract A {}"}}})",
+		R"({"language": "Hyperion", "sources": {"B.hyp": {"content": "contract B { function f() public {} }"}}})",
+		"{invalid json",
+	};
+
+	string framedRequests;
+	string expectedOutput;
+	for (string const& request: requests)
+	{
+		OptionsReaderAndMessages oneShotResult = runCLI({"hypc", "--standard-json"}, request);
+		BOOST_REQUIRE(oneShotResult.success);
+		framedRequests += to_string(request.size()) + "\n" + request;
+		expectedOutput += to_string(oneShotResult.stdoutContent.size()) + "\n" + oneShotResult.stdoutContent;
+	}
+
+	OptionsReaderAndMessages result = runCLI({"hypc", "--standard-json-server"}, framedRequests);
+	BOOST_TEST(result.success);
+	BOOST_TEST(result.stderrContent == "");
+	BOOST_TEST(result.options.input.mode == InputMode::StandardJsonServer);
+	BOOST_TEST(result.stdoutContent == expectedOutput);
+
+	result = runCLI({"hypc", "--standard-json-server", "--no-color"}, "12\n{}");
+	BOOST_TEST(!result.success);
+	BOOST_TEST(result.stderrContent == "Error: Unexpected end of input while reading a Standard JSON request.\n");
+}
+
 BOOST_AUTO_TEST_CASE(cli_paths_to_source_unit_names_no_base_path)
 {
 	TemporaryDirectory tempDirCurrent(TEST_CASE_NAME);
@@ -142,6 +142,7 @@ BOOST_AUTO_TEST_CASE(cli_mode_options)
 			"--optimize-yul",
 			"--optimize-runs=1000",
 			"--yul-optimizations=agf",
+			"--yul-min-round-gain=5",
 			"--model-checker-bmc-loop-iterations=2",
 			"--model-checker-contracts=contract1.yul:A,contract2.yul:B",
 			"--model-checker-div-mod-no-slacks",
@@ -208,6 +209,7 @@ BOOST_AUTO_TEST_CASE(cli_mode_options)
 		expectedOptions.optimizer.optimizeYul = true;
 		expectedOptions.optimizer.expectedExecutionsPerDeployment = 1000;
 		expectedOptions.optimizer.yulSteps = "agf";
+		expectedOptions.optimizer.yulMinRoundGain = 5;
 
 		expectedOptions.modelChecker.initialize = true;
 		expectedOptions.modelChecker.settings = {
@@ -455,6 +457,16 @@ BOOST_AUTO_TEST_CASE(invalid_options_input_modes_combinations)
 		}
 }
 
+BOOST_AUTO_TEST_CASE(invalid_output_selection_in_standard_json_server_mode)
+{
+	vector<string> commandLine = {"hypc", "--standard-json-server", "--bin"};
+
+	string expectedMessage = "The following outputs are not supported in standard JSON server mode: --bin.";
+	auto hasCorrectMessage = [&](CommandLineValidationError const& _exception) { return _exception.what() == expectedMessage; };
+
+	BOOST_CHECK_EXCEPTION(parseCommandLine(commandLine), CommandLineValidationError, hasCorrectMessage);
+}
+
 BOOST_AUTO_TEST_CASE(optimizer_flags)
 {
 	OptimiserSettings yulOnly = OptimiserSettings::minimal();
@@ -608,6 +620,41 @@ BOOST_AUTO_TEST_CASE(invalid_optimizer_sequence_without_optimize)
 	BOOST_CHECK_EXCEPTION(parseCommandLine(commandLineOptions), CommandLineValidationError, hasCorrectMessage);
 }
 
+BOOST_AUTO_TEST_CASE(yul_min_round_gain)
+{
+	CommandLineOptions const& commandLineOptions = parseCommandLine({"hypc", "contract.hyp", "--optimize", "--yul-min-round-gain=10"});
+	BOOST_CHECK_EQUAL(commandLineOptions.optimiserSettings().yulOptimiserMinRoundGain, 10u);
+	BOOST_CHECK_EQUAL(parseCommandLine({"hypc", "contract.hyp", "--optimize"}).optimiserSettings().yulOptimiserMinRoundGain, 0u);
+
+	string const expectedErrorMessage{"--yul-min-round-gain must be a percentage between 0 and 100."};
+	auto hasCorrectMessage = [&](CommandLineValidationError const& _exception) { return _exception.what() == expectedErrorMessage; };
+	BOOST_CHECK_EXCEPTION(
+		parseCommandLine({"hypc", "contract.hyp", "--optimize", "--yul-min-round-gain=101"}),
+		CommandLineValidationError,
+		hasCorrectMessage
+	);
+}
+
+BOOST_AUTO_TEST_CASE(yul_min_round_gain_without_optimize)
+{
+	string const expectedErrorMessage{"--yul-min-round-gain is invalid if Yul optimizer is disabled."};
+	auto hasCorrectMessage = [&](CommandLineValidationError const& _exception) { return _exception.what() == expectedErrorMessage; };
+	BOOST_CHECK_EXCEPTION(
+		parseCommandLine({"hypc", "contract.hyp", "--yul-min-round-gain=10"}),
+		CommandLineValidationError,
+		hasCorrectMessage
+	);
+	BOOST_CHECK_EXCEPTION(
+		parseCommandLine({"hypc", "contract.hyp", "--optimize", "--no-optimize-yul", "--yul-min-round-gain=10"}),
+		CommandLineValidationError,
+		hasCorrectMessage
+	);
+	BOOST_CHECK_EQUAL(
+		parseCommandLine({"hypc", "contract.hyp", "--optimize-yul", "--yul-min-round-gain=10"}).optimiserSettings().yulOptimiserMinRoundGain,
+		10u
+	);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 } // namespace hyperion::frontend::test
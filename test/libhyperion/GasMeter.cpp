@@ -349,4 +349,42 @@ BOOST_AUTO_TEST_CASE(complex_control_flow)
 
 BOOST_AUTO_TEST_SUITE_END()
 
+BOOST_AUTO_TEST_SUITE(PathGasMeterTests)
+
+BOOST_AUTO_TEST_CASE(shared_block)
+{
+	// Both branches of the conditional jump continue at tag 2, the one at tag 1 is more expensive.
+	AssemblyItems const cheapBranch{u256(1), u256(2), Instruction::ADD, Instruction::POP};
+	AssemblyItems const expensiveBranch{u256(1), u256(2), Instruction::MUL, u256(3), Instruction::EXP, Instruction::POP};
+	AssemblyItems const sharedBlock{AssemblyItem(Tag, 2), u256(0), Instruction::SLOAD, Instruction::POP, Instruction::STOP};
+
+	AssemblyItems items{u256(0), Instruction::CALLDATALOAD, AssemblyItem(PushTag, 1), Instruction::JUMPI};
+	items += cheapBranch;
+	items += AssemblyItems{AssemblyItem(PushTag, 2), Instruction::JUMP, AssemblyItem(Tag, 1)};
+	items += expensiveBranch;
+	items += AssemblyItems{AssemblyItem(PushTag, 2), Instruction::JUMP};
+	items += sharedBlock;
+
+	// The most expensive path, run without any branching.
+	AssemblyItems expensivePath{u256(0), Instruction::CALLDATALOAD, AssemblyItem(PushTag, 1), Instruction::JUMPI, AssemblyItem(Tag, 1)};
+	expensivePath += expensiveBranch;
+	expensivePath += AssemblyItems{AssemblyItem(PushTag, 2), Instruction::JUMP};
+	expensivePath += sharedBlock;
+	GasMeter meter(std::make_shared<KnownState>(), hyperion::test::CommonOptions::get().qrvmVersion());
+	GasMeter::GasConsumption expectation;
+	for (AssemblyItem const& item: expensivePath)
+		expectation += meter.estimateMax(item);
+
+	PathGasMeter pathMeter(items, hyperion::test::CommonOptions::get().qrvmVersion());
+	GasMeter::GasConsumption gas = pathMeter.estimateMax(0, std::make_shared<KnownState>());
+	BOOST_REQUIRE(!gas.isInfinite);
+	BOOST_CHECK_EQUAL(gas.value, expectation.value);
+	// A second estimate reuses the block summaries and has to arrive at the same result.
+	gas = pathMeter.estimateMax(0, std::make_shared<KnownState>());
+	BOOST_REQUIRE(!gas.isInfinite);
+	BOOST_CHECK_EQUAL(gas.value, expectation.value);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
 }
@@ -27,9 +27,12 @@
 #include <liblangutil/Exceptions.h>
 #include <libhyperion/interface/CompilerStack.h>
 #include <libhyperion/interface/ImportRemapper.h>
+#include <libhyperion/ast/ASTJsonExporter.h>
+#include <libhyputil/JSON.h>
 
 #include <boost/test/unit_test.hpp>
 
+#include <algorithm>
 #include <string>
 
 
@@ -112,6 +115,81 @@ BOOST_AUTO_TEST_CASE(context_dependent_remappings_order_independent_2)
 	BOOST_CHECK(c.compile());
 }
 
+BOOST_AUTO_TEST_CASE(concurrent_parsing_matches_sequential_parsing)
+{
+	// Every kind of node that can have structured documentation is documented.
+	std::map<std::string, std::string> const sources{
+		{"a.hyp",
+			"import \"b.hyp\"; import \"c.hyp\";\n"
+			"/// @dev A\ncontract A is B {\n"
+			"	/// @dev x\nuint x;\n"
+			"	/// @dev p\nuint public p;\n"
+			"	/// @dev constructor\nconstructor() {}\n"
+			"	/// @dev m\nmodifier m() { _; }\n"
+			"	/// @dev f\nfunction f() public m {}\n"
+			"	/// @dev k\nfunction k() public override {}\n"
+			"	/// @dev receive\nreceive() external payable {}\n"
+			"	/// @dev Ev\nevent Ev();\n"
+			"	/// @dev Er\nerror Er();\n"
+			"	/// @dev SA\nstruct SA { uint a; }\n"
+			"	/// @dev EA\nenum EA { P }\n"
+			"}\n"
+			"pragma hyperion >=0.0;"
+		},
+		{"b.hyp",
+			"/// @dev S\nstruct S { uint a; }\n"
+			"/// @dev E\nenum E { X, Y }\n"
+			"/// @dev I\ninterface I { /// @dev g\nfunction g() external; }\n"
+			"/// @dev L\nlibrary L { /// @dev h\nfunction h() internal pure {} }\n"
+			"/// @dev B\nabstract contract B { /// @dev y\nS y; E z; /// @dev k\nfunction k() public virtual {} }\n"
+			"pragma hyperion >=0.0;"
+		},
+		{"c.hyp",
+			"import \"d.hyp\";\n"
+			"/// @dev free\nfunction free() pure {}\n"
+			"/// @dev FE\nevent FE();\n"
+			"/// @dev FErr\nerror FErr();\n"
+			"/// @dev T\nstruct T { uint b; }\n"
+			"contract C { /// @dev w\nT w; }\n"
+			"pragma hyperion >=0.0;"
+		},
+		{"d.hyp",
+			"/// @dev F\nenum F { Z }\n"
+			"/// @dev v\nuint constant v = 1;\n"
+			"pragma hyperion >=0.0;"
+		}
+	};
+	auto astJson = [&](size_t _threadCount) {
+		CompilerStack c;
+		c.setSources(sources);
+		c.setQRVMVersion(hyperion::test::CommonOptions::get().qrvmVersion());
+		c.setParserThreadCount(_threadCount);
+		BOOST_REQUIRE(c.parseAndAnalyze());
+		std::string result;
+		for (auto const& source: sources)
+			result += util::jsonCompactPrint(ASTJsonExporter(c.state()).toJson(c.ast(source.first))) + "\n";
+		return result;
+	};
+	BOOST_CHECK_EQUAL(astJson(4), astJson(1));
+}
+
+BOOST_AUTO_TEST_CASE(concurrent_parsing_deep_nesting)
+{
+	// Deeper than the parser allows. The worker threads must have enough stack to get there.
+	std::string const nesting(1500, '(');
+	CompilerStack c;
+	c.setSources({
+		{"a.hyp", "function f() pure returns (uint) { return " + nesting + "1" + std::string(nesting.size(), ')') + "; } pragma hyperion >=0.0;"},
+		{"b.hyp", "contract B {} pragma hyperion >=0.0;"}
+	});
+	c.setQRVMVersion(hyperion::test::CommonOptions::get().qrvmVersion());
+	c.setParserThreadCount(2);
+	BOOST_CHECK(!c.parse());
+	BOOST_CHECK(std::any_of(c.errors().begin(), c.errors().end(), [](auto const& _error) {
+		return searchErrorMessage(*_error, "Maximum recursion depth reached during parsing.");
+	}));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 } // end namespaces
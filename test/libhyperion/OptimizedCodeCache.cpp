@@ -0,0 +1,118 @@
+/*
+	This file is part of hyperion.
+
+	hyperion is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	hyperion is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with hyperion.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Unit tests for the cache of optimized Yul objects shared by the contracts of a compilation.
+ */
+
+#include <test/Common.h>
+
+#include <libhyperion/interface/CompilerStack.h>
+#include <libyul/Object.h>
+#include <libyul/YulStack.h>
+
+#include <boost/test/unit_test.hpp>
+
+namespace hyperion::frontend::test
+{
+
+namespace
+{
+
+/// @returns the number of objects in the tree rooted at @a _object, counting embedded ones each time.
+size_t objectCount(yul::Object const& _object)
+{
+	size_t count = 1;
+	for (auto const& subNode: _object.subObjects)
+		if (auto const* subObject = dynamic_cast<yul::Object const*>(subNode.get()))
+			count += objectCount(*subObject);
+	return count;
+}
+
+/// Optimizes and assembles @a _yulIR.
+/// @returns the creation bytecode and the number of objects that were optimized.
+std::pair<bytes, size_t> compileIR(std::string const& _yulIR, std::shared_ptr<yul::OptimizedCodeCache> _cache)
+{
+	yul::YulStack stack(
+		hyperion::test::CommonOptions::get().qrvmVersion(),
+		yul::YulStack::Language::StrictAssembly,
+		OptimiserSettings::standard(),
+		langutil::DebugInfoSelection::Default(),
+		std::move(_cache)
+	);
+	BOOST_REQUIRE(stack.parseAndAnalyze("", _yulIR));
+	stack.optimize();
+	size_t const count = objectCount(*stack.parserResult());
+	yul::MachineAssemblyObject creation = stack.assembleWithDeployed().first;
+	BOOST_REQUIRE(creation.bytecode);
+	return {creation.bytecode->bytecode, count};
+}
+
+}
+
+BOOST_AUTO_TEST_SUITE(OptimizedCodeCache)
+
+BOOST_AUTO_TEST_CASE(factory_contract)
+{
+	// A is embedded into both the creation and the deployed object of the factory,
+	// B into the deployed object only, but created in two places.
+	char const* sourceCode = R"(
+		contract A {
+			uint public x;
+			constructor(uint _x) { x = _x; }
+			function f(uint y) public view returns (uint) { return x * y + 1; }
+		}
+		contract B {
+			function g(uint[] memory a) public pure returns (uint s) { for (uint i = 0; i < a.length; ++i) s += a[i]; }
+		}
+		contract Factory {
+			A public a;
+			constructor() { a = new A(1); }
+			function createA(uint x) public returns (A) { return new A(x); }
+			function createB() public returns (B) { return new B(); }
+			function createBs() public returns (B, B) { return (new B(), new B()); }
+		}
+	)";
+
+	CompilerStack compiler;
+	compiler.setSources({{"A.hyp", sourceCode}});
+	compiler.setQRVMVersion(hyperion::test::CommonOptions::get().qrvmVersion());
+	compiler.setOptimiserSettings(OptimiserSettings::standard());
+	compiler.setViaIR(true);
+	BOOST_REQUIRE_MESSAGE(compiler.compile(), "Compiling contract failed");
+	std::string const& yulIR = compiler.yulIR("Factory");
+
+	auto const [uncachedBytecode, objects] = compileIR(yulIR, nullptr);
+	auto cache = std::make_shared<yul::OptimizedCodeCache>();
+	auto const [cachedBytecode, cachedObjects] = compileIR(yulIR, cache);
+
+	BOOST_CHECK_EQUAL(objects, cachedObjects);
+	// Every embedded copy of A beyond the first one is taken from the cache.
+	BOOST_CHECK(cache->code.size() < objects);
+	BOOST_CHECK(cachedBytecode == uncachedBytecode);
+	// The compiler stack shares the cache between all contracts of the compilation.
+	BOOST_CHECK(compiler.object("Factory").bytecode == uncachedBytecode);
+
+	// Compiling again with a populated cache still produces the same bytecode.
+	size_t const cachedCode = cache->code.size();
+	BOOST_CHECK(compileIR(yulIR, cache).first == uncachedBytecode);
+	BOOST_CHECK_EQUAL(cache->code.size(), cachedCode);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}
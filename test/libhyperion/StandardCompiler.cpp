@@ -27,6 +27,7 @@
 #include <libhyperion/interface/Version.h>
 #include <libhyputil/JSON.h>
 #include <libhyputil/CommonData.h>
+#include <libyul/YulStack.h>
 #include <test/Metadata.h>
 
 #include <algorithm>
@@ -347,6 +348,27 @@ BOOST_AUTO_TEST_CASE(optimizer_runs_not_an_unsigned_number)
 	BOOST_CHECK(containsError(result, "JSONError", "The \"runs\" setting must be an unsigned number."));
 }
 
+BOOST_AUTO_TEST_CASE(optimizer_min_round_gain_out_of_range)
+{
+	char const* input = R"(
+	{
+		"language": "Hyperion",
+		"settings": {
+			"optimizer": {
+				"details": { "yul": true, "yulDetails": { "minRoundGain": 101 } }
+			}
+		},
+		"sources": {
+			"empty": {
+				"content": ""
+			}
+		}
+	}
+	)";
+	Json::Value result = compile(input);
+	BOOST_CHECK(containsError(result, "JSONError", "The \"minRoundGain\" setting must be an unsigned number not greater than 100."));
+}
+
 BOOST_AUTO_TEST_CASE(basic_compilation)
 {
 	char const* input = R"(
@@ -1226,6 +1248,38 @@ BOOST_AUTO_TEST_CASE(optimizer_settings_details_different)
 	BOOST_CHECK(optimizer["runs"].asUInt() == 600);
 }
 
+BOOST_AUTO_TEST_CASE(optimizer_settings_min_round_gain)
+{
+	char const* input = R"(
+	{
+		"language": "Hyperion",
+		"settings": {
+			"outputSelection": {
+				"fileA": { "A": [ "metadata" ] }
+			},
+			"optimizer": { "enabled": true, "details": {
+				"yul": true,
+				"yulDetails": { "minRoundGain": 5 }
+			} }
+		},
+		"sources": {
+			"fileA": {
+				"content": "contract A { }"
+			}
+		}
+	}
+	)";
+	Json::Value result = compile(input);
+	BOOST_CHECK(containsAtMostWarnings(result));
+	Json::Value contract = getContractResult(result, "fileA", "A");
+	Json::Value metadata;
+	BOOST_REQUIRE(util::jsonParseStrict(contract["metadata"].asString(), metadata));
+
+	Json::Value const& yulDetails = metadata["settings"]["optimizer"]["details"]["yulDetails"];
+	BOOST_REQUIRE(yulDetails.isObject());
+	BOOST_CHECK(yulDetails["minRoundGain"].asUInt() == 5);
+}
+
 BOOST_AUTO_TEST_CASE(metadata_without_compilation)
 {
 	// NOTE: the contract code here should fail to compile due to "out of stack"
@@ -1784,6 +1838,45 @@ BOOST_AUTO_TEST_CASE(source_location_of_bare_block)
 	BOOST_REQUIRE(sourceMap.find(sourceRef) != std::string::npos);
 }
 
+BOOST_AUTO_TEST_CASE(persistent_optimized_code_cache)
+{
+	char const* input = R"(
+	{
+		"language": "Hyperion",
+		"sources": {
+			"A.hyp": {
+				"content": "contract A { function f(uint x) public pure returns (uint) { return x * 2; } } contract B { function g() public { new A(); } }"
+			}
+		},
+		"settings": {
+			"viaIR": true,
+			"optimizer": { "enabled": true },
+			"outputSelection": {
+				"A.hyp": {
+					"*": ["irOptimized", "qrvm.bytecode.object", "qrvm.bytecode.sourceMap", "qrvm.deployedBytecode.object"]
+				}
+			}
+		}
+	}
+	)";
+
+	Json::Value parsedInput;
+	BOOST_REQUIRE(util::jsonParseStrict(input, parsedInput));
+
+	Json::Value expected = hyperion::frontend::StandardCompiler{}.compile(parsedInput);
+	BOOST_REQUIRE(expected["contracts"]["A.hyp"]["B"]["qrvm"]["bytecode"]["object"].isString());
+
+	auto cache = std::make_shared<hyperion::yul::PersistentOptimizedCodeCache>();
+	for (size_t i = 0; i < 2; ++i)
+	{
+		hyperion::frontend::StandardCompiler compiler;
+		compiler.setPersistentOptimizedCodeCache(cache);
+		Json::Value result = compiler.compile(parsedInput);
+		BOOST_CHECK(result["contracts"] == expected["contracts"]);
+		BOOST_CHECK(!cache->code.empty());
+	}
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 } // end namespaces
@@ -0,0 +1,81 @@
+/*
+	This file is part of hyperion.
+
+	hyperion is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	hyperion is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with hyperion.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Unit tests for the helpers in Concurrency.h.
+ */
+
+#include <libhyputil/Concurrency.h>
+
+#include <boost/test/unit_test.hpp>
+
+#include <atomic>
+#include <vector>
+
+namespace hyperion::util::test
+{
+
+namespace
+{
+
+/// Uses about @a _depth KiB of stack.
+size_t recurse(size_t _depth)
+{
+	volatile char buffer[1024] = {};
+	buffer[_depth % sizeof(buffer)] = static_cast<char>(_depth);
+	if (_depth == 0)
+		return buffer[0];
+	return recurse(_depth - 1) + buffer[_depth % sizeof(buffer)];
+}
+
+}
+
+BOOST_AUTO_TEST_SUITE(Concurrency)
+
+BOOST_AUTO_TEST_CASE(every_index_once)
+{
+	std::vector<std::atomic<size_t>> calls(1000);
+	forEachIndexConcurrently(calls.size(), 4, [&](size_t _index) { ++calls[_index]; });
+	for (std::atomic<size_t> const& count: calls)
+		BOOST_CHECK_EQUAL(count.load(), 1u);
+}
+
+BOOST_AUTO_TEST_CASE(more_threads_than_indices)
+{
+	std::vector<std::atomic<size_t>> calls(3);
+	forEachIndexConcurrently(calls.size(), 16, [&](size_t _index) { ++calls[_index]; });
+	for (std::atomic<size_t> const& count: calls)
+		BOOST_CHECK_EQUAL(count.load(), 1u);
+	forEachIndexConcurrently(0, 16, [&](size_t) { BOOST_FAIL("No index expected."); });
+}
+
+BOOST_AUTO_TEST_CASE(deep_recursion_on_workers)
+{
+	// Much more than the default stack of secondary threads on macOS (512 KiB), but less than
+	// the stack of the main thread, which also takes part.
+	size_t const depth = 4 * 1024;
+	std::vector<size_t> results(8);
+	forEachIndexConcurrently(results.size(), results.size(), [&](size_t _index) {
+		results[_index] = recurse(depth);
+	});
+	for (size_t result: results)
+		BOOST_CHECK_EQUAL(result, recurse(depth));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}
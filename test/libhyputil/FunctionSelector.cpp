@@ -24,6 +24,7 @@
 
 #include <cstdint>
 #include <sstream>
+#include <string>
 
 
 namespace hyperion::util::test
@@ -47,6 +48,25 @@ BOOST_AUTO_TEST_CASE(conversions)
 	);
 }
 
+BOOST_AUTO_TEST_CASE(compile_time_selectors)
+{
+	static_assert(util::c_errorStringSelector == 0x08c379a0);
+	static_assert(util::c_panicSelector == 0x4e487b71);
+	static_assert(util::selectorFromSignatureConstexpr("test()") == 0xf8a8fd6d);
+
+	// Cover inputs around and beyond the block size of 136 bytes.
+	for (size_t length = 0; length < 300; ++length)
+	{
+		std::string signature(length, 'a');
+		for (size_t i = 0; i < length; ++i)
+			signature[i] = static_cast<char>('a' + (i * 7 + length) % 26);
+		BOOST_CHECK_EQUAL(
+			util::selectorFromSignatureConstexpr(signature),
+			util::selectorFromSignatureU32(signature)
+		);
+	}
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 }
@@ -240,6 +240,20 @@ BOOST_AUTO_TEST_CASE(invalid_param_rendered)
 	BOOST_CHECK_EQUAL(m.render(), templ);
 }
 
+BOOST_AUTO_TEST_CASE(unmatched_tags_rendered)
+{
+	std::string templ = "<#a> <?b>x<!b> <c> < <>";
+	std::string result = Whiskers(templ)("c", "C").render();
+	BOOST_CHECK_EQUAL(result, "<#a> <?b>x<!b> C < <>");
+}
+
+BOOST_AUTO_TEST_CASE(condition_ends_at_first_closing_tag)
+{
+	std::string templ = "<?a>X<!a>Y</a>Z</a>";
+	BOOST_CHECK_EQUAL(Whiskers(templ)("a", true).render(), "XZ</a>");
+	BOOST_CHECK_EQUAL(Whiskers(templ)("a", false).render(), "YZ</a>");
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 }
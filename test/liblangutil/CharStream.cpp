@@ -128,6 +128,49 @@ BOOST_AUTO_TEST_CASE(translateLineColumnToPosition)
 	BOOST_CHECK_EQUAL(toPosition(2, 0, "ABC\nDEF\nGHI\n"), 8);
 	BOOST_CHECK_EQUAL(toPosition(2, 1, "ABC\nDEF\nGHI\n"), 9);
 	BOOST_CHECK_EQUAL(toPosition(2, 2, "ABC\nDEF\nGHI\n"), 10);
+
+	// Negative columns on later lines
+	BOOST_CHECK_EQUAL(toPosition(1, -1, "ABC\nDEF"), std::nullopt);
+}
+
+BOOST_AUTO_TEST_CASE(translatePositionToLineColumn)
+{
+	CharStream const source{"ABC\nDEF\n\nGHI", "source"};
+	auto check = [&](int _position, int _line, int _column)
+	{
+		LineColumn lineColumn = source.translatePositionToLineColumn(_position);
+		BOOST_CHECK_EQUAL(lineColumn.line, _line);
+		BOOST_CHECK_EQUAL(lineColumn.column, _column);
+	};
+
+	check(0, 0, 0);
+	check(2, 0, 2);
+	check(3, 0, 3);
+	check(4, 1, 0);
+	check(7, 1, 3);
+	check(8, 2, 0);
+	check(9, 3, 0);
+	check(11, 3, 2);
+	// Positions past the end are clamped.
+	check(12, 3, 3);
+	check(100, 3, 3);
+}
+
+BOOST_AUTO_TEST_CASE(lineAtPosition)
+{
+	CharStream const source{"ABC\nDEF\r\n\nGHI", "source"};
+
+	BOOST_CHECK_EQUAL(source.lineAtPosition(0), "ABC");
+	BOOST_CHECK_EQUAL(source.lineAtPosition(2), "ABC");
+	// A position pointing at a line feed refers to the line before it.
+	BOOST_CHECK_EQUAL(source.lineAtPosition(3), "ABC");
+	BOOST_CHECK_EQUAL(source.lineAtPosition(4), "DEF");
+	// Carriage returns are not part of the line.
+	BOOST_CHECK_EQUAL(source.lineAtPosition(8), "DEF");
+	BOOST_CHECK_EQUAL(source.lineAtPosition(9), "");
+	BOOST_CHECK_EQUAL(source.lineAtPosition(10), "GHI");
+	BOOST_CHECK_EQUAL(source.lineAtPosition(12), "GHI");
+	BOOST_CHECK_EQUAL(source.lineAtPosition(100), "GHI");
 }
 
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,107 @@
+/*
+	This file is part of hyperion.
+
+	hyperion is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	hyperion is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with hyperion.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Tests for the bytecode statistics in Disassemble.h.
+ */
+
+#include <libqrvmasm/Disassemble.h>
+
+#include <boost/test/unit_test.hpp>
+
+#include <vector>
+
+using namespace hyperion::qrvmasm;
+
+namespace hyperion::frontend::test
+{
+
+namespace
+{
+	uint8_t op(Instruction _instruction)
+	{
+		return static_cast<uint8_t>(_instruction);
+	}
+}
+
+BOOST_AUTO_TEST_SUITE(Disassemble)
+
+BOOST_AUTO_TEST_CASE(push_data_is_skipped)
+{
+	// The push data of PUSH2 and PUSH64 contains JUMPDEST opcodes that must not be counted.
+	bytes code{op(Instruction::PUSH2), op(Instruction::JUMPDEST), op(Instruction::JUMPDEST), op(Instruction::JUMPDEST)};
+	code.push_back(op(Instruction::PUSH64));
+	code += bytes(64, op(Instruction::JUMPDEST));
+	code += bytes{op(Instruction::JUMPDEST), op(Instruction::STOP)};
+
+	CodeStatistics const statistics = codeStatistics(bytesConstRef(&code));
+	BOOST_CHECK_EQUAL(statistics.opcodeCounts[op(Instruction::PUSH2)], 1);
+	BOOST_CHECK_EQUAL(statistics.opcodeCounts[op(Instruction::PUSH64)], 1);
+	BOOST_CHECK_EQUAL(statistics.opcodeCounts[op(Instruction::JUMPDEST)], 2);
+	BOOST_CHECK_EQUAL(statistics.opcodeCounts[op(Instruction::STOP)], 1);
+	BOOST_CHECK((statistics.jumpdests == std::vector<size_t>{3, 69}));
+	BOOST_CHECK(!statistics.metadataOffset);
+}
+
+BOOST_AUTO_TEST_CASE(matches_each_instruction)
+{
+	bytes code;
+	for (size_t byte = 0; byte < 256; ++byte)
+		code.push_back(static_cast<uint8_t>(byte));
+	// Truncated push at the end of the code.
+	code.push_back(op(Instruction::PUSH32));
+
+	std::array<size_t, 256> expectation{};
+	eachInstruction(code, [&](Instruction _instruction, u512 const&) { ++expectation[op(_instruction)]; });
+	BOOST_CHECK(codeStatistics(bytesConstRef(&code)).opcodeCounts == expectation);
+}
+
+BOOST_AUTO_TEST_CASE(metadata)
+{
+	bytes code{op(Instruction::JUMPDEST), op(Instruction::STOP)};
+	// CBOR map with one entry {"a": 1}, followed by its length.
+	bytes const metadata{0xa1, 0x61, 'a', 0x01};
+	code += metadata;
+	code += bytes{0x00, static_cast<uint8_t>(metadata.size())};
+
+	CodeStatistics const statistics = codeStatistics(bytesConstRef(&code));
+	BOOST_REQUIRE(statistics.metadataOffset);
+	BOOST_CHECK_EQUAL(*statistics.metadataOffset, 2);
+	BOOST_CHECK_EQUAL(statistics.opcodeCounts[op(Instruction::JUMPDEST)], 1);
+	BOOST_CHECK_EQUAL(statistics.opcodeCounts[op(Instruction::STOP)], 1);
+	// Nothing inside the metadata is counted.
+	size_t total = 0;
+	for (size_t count: statistics.opcodeCounts)
+		total += count;
+	BOOST_CHECK_EQUAL(total, 2);
+}
+
+BOOST_AUTO_TEST_CASE(no_metadata)
+{
+	// The length field points before the start of the code.
+	bytes code{op(Instruction::STOP), 0x00, 0x10};
+	BOOST_CHECK(!metadataOffset(bytesConstRef(&code)));
+	// The length field points at something that is not a CBOR map.
+	code = bytes{op(Instruction::STOP), op(Instruction::STOP), 0x00, 0x01};
+	BOOST_CHECK(!metadataOffset(bytesConstRef(&code)));
+	code = bytes{0x00};
+	BOOST_CHECK(!metadataOffset(bytesConstRef(&code)));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // end namespaces
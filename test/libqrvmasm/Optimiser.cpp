@@ -94,33 +94,18 @@ namespace
 	}
 
 	/// In contrast to the function `CSE`, this function doesn't finish the CSE optimization on an
-	/// instruction that breaks CSE Analysis block. Copied from Assembly.cpp
+	/// instruction that breaks CSE Analysis block. It runs the CSE through Assembly::optimise.
 	AssemblyItems fullCSE(AssemblyItems const& _input)
 	{
-		AssemblyItems optimisedItems;
-
-		bool usesMSize = ranges::any_of(_input, [](AssemblyItem const& _i) {
-			return _i == AssemblyItem{Instruction::MSIZE} || _i.type() == VerbatimBytecode;
-		});
-
-		auto iter = _input.begin();
-		while (iter != _input.end())
-		{
-			KnownState emptyState;
-			CommonSubexpressionEliminator eliminator{emptyState};
-			auto orig = iter;
-			iter = eliminator.feedItems(iter, _input.end(), usesMSize);
-			bool shouldReplace = false;
-			AssemblyItems optimisedChunk;
-			optimisedChunk = eliminator.getOptimizedItems();
-			shouldReplace = (optimisedChunk.size() < static_cast<size_t>(iter - orig));
-			if (shouldReplace)
-				optimisedItems += optimisedChunk;
-			else
-				copy(orig, iter, back_inserter(optimisedItems));
-		}
-
-		return optimisedItems;
+		Assembly::OptimiserSettings settings;
+		settings.runCSE = true;
+		settings.qrvmVersion = hyperion::test::CommonOptions::get().qrvmVersion();
+
+		Assembly assembly{settings.qrvmVersion, false, {}};
+		for (AssemblyItem const& item: _input)
+			assembly.append(item);
+		assembly.optimise(settings);
+		return assembly.items();
 	}
 
 	void checkFullCSE(
@@ -1432,6 +1417,40 @@ BOOST_AUTO_TEST_CASE(cse_verbatim_eq)
 	checkFullCSE(input, input);
 }
 
+BOOST_AUTO_TEST_CASE(cse_jumpi_fallthrough_keeps_knowledge)
+{
+	AssemblyItems input{
+		u256(0),
+		Instruction::SLOAD,
+		Instruction::DUP1,
+		AssemblyItem(PushTag, 1),
+		Instruction::JUMPI,
+		u256(0),
+		Instruction::SLOAD,	// Known from before the JUMPI
+		Instruction::ADD
+	};
+
+	AssemblyItems output = fullCSE(input);
+	BOOST_CHECK_EQUAL(1, count(output.begin(), output.end(), AssemblyItem(Instruction::SLOAD)));
+}
+
+BOOST_AUTO_TEST_CASE(cse_tag_resets_knowledge)
+{
+	AssemblyItems input{
+		u256(0),
+		Instruction::SLOAD,
+		Instruction::DUP1,
+		AssemblyItem(PushTag, 1),
+		Instruction::JUMPI,
+		AssemblyItem(Tag, 2),
+		u256(0),
+		Instruction::SLOAD,	// Should not be removed, the tag can be reached from elsewhere
+		Instruction::ADD
+	};
+
+	checkFullCSE(input, input);
+}
+
 BOOST_AUTO_TEST_CASE(verbatim_knownstate)
 {
 	KnownState state = createInitialState(AssemblyItems{
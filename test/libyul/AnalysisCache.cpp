@@ -0,0 +1,90 @@
+/*
+    This file is part of hyperion.
+
+    hyperion is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    hyperion is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with hyperion.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/**
+ * Unit tests for the cache of analyses shared between optimiser steps.
+ */
+
+#include <test/Common.h>
+
+#include <test/libyul/Common.h>
+
+#include <libyul/optimiser/AnalysisCache.h>
+#include <libyul/backends/qrvm/QRVMDialect.h>
+#include <libyul/AST.h>
+
+#include <boost/test/unit_test.hpp>
+
+using namespace std;
+
+namespace hyperion::yul::test
+{
+
+namespace
+{
+
+Dialect const& qrvmDialect()
+{
+	return QRVMDialect::strictAssemblyForQRVM(hyperion::test::CommonOptions::get().qrvmVersion());
+}
+
+/// Removes the first statement from the body of the function that is statement @a _index of @a _ast.
+void removeFirstStatement(Block& _ast, size_t _index)
+{
+	auto& function = get<FunctionDefinition>(_ast.statements.at(_index));
+	function.body.statements.erase(function.body.statements.begin());
+}
+
+}
+
+BOOST_AUTO_TEST_SUITE(YulAnalysisCache)
+
+BOOST_AUTO_TEST_CASE(disabled_recomputes)
+{
+	shared_ptr<Block> ast = parse("{ function f() { sstore(0, 1) } f() }", false).first;
+	BOOST_REQUIRE(ast);
+	AnalysisCache cache;
+	BOOST_CHECK(!cache.enabled());
+	BOOST_CHECK(cache.functionSideEffects(qrvmDialect(), *ast).at("f"_yulstring).storage == SideEffects::Write);
+	removeFirstStatement(*ast, 0);
+	BOOST_CHECK(cache.functionSideEffects(qrvmDialect(), *ast).at("f"_yulstring).storage == SideEffects::None);
+}
+
+BOOST_AUTO_TEST_CASE(enabled_reuses_until_invalidated)
+{
+	shared_ptr<Block> ast = parse("{ function f() { pop(msize()) sstore(0, 1) } f() }", false).first;
+	BOOST_REQUIRE(ast);
+	AnalysisCache cache;
+	cache.setEnabled(true);
+	BOOST_CHECK(cache.containsMSize(qrvmDialect(), *ast));
+	BOOST_CHECK(cache.functionSideEffects(qrvmDialect(), *ast).at("f"_yulstring).storage == SideEffects::Write);
+	BOOST_CHECK(cache.controlFlowSideEffects(qrvmDialect(), *ast).at("f"_yulstring).canContinue);
+	BOOST_CHECK(cache.callGraph(*ast).functionCalls.count("f"_yulstring));
+
+	removeFirstStatement(*ast, 0);
+	BOOST_CHECK(cache.containsMSize(qrvmDialect(), *ast));
+
+	cache.invalidate();
+	BOOST_CHECK(!cache.containsMSize(qrvmDialect(), *ast));
+	BOOST_CHECK(cache.functionSideEffects(qrvmDialect(), *ast).at("f"_yulstring).storage == SideEffects::Write);
+
+	cache.setEnabled(false);
+	BOOST_CHECK(!cache.enabled());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}
@@ -0,0 +1,109 @@
+/*
+	This file is part of hyperion.
+
+	hyperion is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	hyperion is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with hyperion.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Unit tests for the repetition of bracketed parts of optimiser sequences.
+ */
+
+#include <test/Common.h>
+
+#include <test/libyul/Common.h>
+
+#include <libyul/optimiser/NameDispenser.h>
+#include <libyul/optimiser/OptimiserStep.h>
+#include <libyul/optimiser/Suite.h>
+#include <libyul/backends/qrvm/QRVMDialect.h>
+#include <libyul/AST.h>
+
+#include <libhyputil/Common.h>
+
+#include <boost/algorithm/string/find_iterator.hpp>
+#include <boost/algorithm/string/finder.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <iostream>
+#include <sstream>
+
+using namespace std;
+
+namespace hyperion::yul::test
+{
+
+namespace
+{
+
+/// Runs @a _sequence on @a _source in debug mode and @returns what the optimiser suite reported.
+string runWithReport(string const& _source, string const& _sequence, size_t _minRoundGain)
+{
+	shared_ptr<Block> ast = parse(_source, false).first;
+	BOOST_REQUIRE(ast);
+	Dialect const& dialect = QRVMDialect::strictAssemblyForQRVM(hyperion::test::CommonOptions::get().qrvmVersion());
+	set<YulString> const reservedIdentifiers;
+	NameDispenser dispenser(dialect, *ast, reservedIdentifiers);
+	OptimiserStepContext context{dialect, dispenser, reservedIdentifiers, 200};
+
+	ostringstream report;
+	streambuf* originalBuffer = cout.rdbuf(report.rdbuf());
+	ScopeGuard restoreBuffer([&]() { cout.rdbuf(originalBuffer); });
+	OptimiserSuite{context, OptimiserSuite::Debug::PrintStep, _minRoundGain}.runSequence(_sequence, *ast);
+	return report.str();
+}
+
+size_t countOccurrences(string const& _text, string const& _pattern)
+{
+	size_t count = 0;
+	for (
+		auto it = boost::make_find_iterator(_text, boost::first_finder(_pattern));
+		it != boost::algorithm::find_iterator<string::const_iterator>();
+		++it
+	)
+		++count;
+	return count;
+}
+
+}
+
+BOOST_AUTO_TEST_SUITE(YulOptimiserSuite)
+
+BOOST_AUTO_TEST_CASE(repeats_until_stable_by_default)
+{
+	string report = runWithReport("{ sstore(0, 1) }", "[u]", 0);
+	// The first round has nothing to compare against, the second one finds the code unchanged.
+	BOOST_CHECK_EQUAL(countOccurrences(report, "Running UnusedPruner"), 2u);
+	BOOST_CHECK_EQUAL(countOccurrences(report, "Round 2 of [u]"), 1u);
+	BOOST_CHECK_EQUAL(countOccurrences(report, "no further rounds"), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(min_round_gain_stops_early)
+{
+	string report = runWithReport("{ sstore(0, 1) }", "[u]", 1);
+	BOOST_CHECK_EQUAL(countOccurrences(report, "Running UnusedPruner"), 1u);
+	BOOST_CHECK_EQUAL(countOccurrences(report, "Round 2 of [u]"), 0u);
+	BOOST_CHECK_EQUAL(countOccurrences(report, "Gain below 1%, no further rounds."), 1u);
+}
+
+BOOST_AUTO_TEST_CASE(min_round_gain_keeps_productive_rounds)
+{
+	// The first round removes most of the code, only the unchanged second round is below the threshold.
+	string report = runWithReport("{ let a := 1 let b := 2 let c := 3 sstore(0, 1) }", "[u]", 10);
+	BOOST_CHECK_EQUAL(countOccurrences(report, "Running UnusedPruner"), 2u);
+	BOOST_CHECK_EQUAL(countOccurrences(report, "Gain below 10%, no further rounds."), 1u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}
@@ -0,0 +1,258 @@
+/*
+	This file is part of hyperion.
+
+	hyperion is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	hyperion is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with hyperion.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Collects opcode statistics over large sets of deployed bytecode.
+ */
+
+#include <libqrvmasm/Disassemble.h>
+
+#include <libhyputil/CommonData.h>
+#include <libhyputil/Exceptions.h>
+#include <libhyputil/JSON.h>
+
+#include <boost/program_options.hpp>
+
+#include <array>
+#include <cstdint>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace hyperion;
+using namespace hyperion::util;
+using namespace hyperion::qrvmasm;
+
+namespace po = boost::program_options;
+
+namespace
+{
+
+class BytecodeStats
+{
+public:
+	explicit BytecodeStats(bool _perContract): m_perContract(_perContract) {}
+
+	/// Processes one hex encoded contract per line of @a _input.
+	/// @returns false if a line is not valid hex.
+	bool processStream(std::istream& _input, std::string const& _name)
+	{
+		std::string line;
+		for (size_t lineNumber = 1; std::getline(_input, line); ++lineNumber)
+		{
+			size_t begin = line.find_first_not_of(" \t");
+			size_t end = line.find_last_not_of(" \t\r");
+			if (begin == std::string::npos)
+				continue;
+			if (line.compare(begin, 2, "0x") == 0)
+				begin += 2;
+			bytes code;
+			try
+			{
+				code = fromHex(line.substr(begin, end + 1 - begin), WhenError::Throw);
+			}
+			catch (BadHexCharacter const&)
+			{
+				std::cerr << _name << ":" << lineNumber << ": Invalid hex string." << std::endl;
+				return false;
+			}
+			process(code);
+		}
+		return true;
+	}
+
+	void printJson() const
+	{
+		Json::Value opcodes{Json::objectValue};
+		for (size_t opcode = 0; opcode < m_opcodeCounts.size(); ++opcode)
+			if (m_opcodeCounts[opcode] > 0)
+				opcodes[opcodeName(static_cast<uint8_t>(opcode))] = Json::UInt64(m_opcodeCounts[opcode]);
+
+		Json::Value histogram{Json::objectValue};
+		histogram["contracts"] = Json::UInt64(m_contracts);
+		histogram["bytes"] = Json::UInt64(m_bytes);
+		histogram["opcodes"] = opcodes;
+		std::cout << jsonCompactPrint(histogram) << std::endl;
+	}
+
+	/// Prints the number of contracts, the number of bytes and the 256 opcode counts
+	/// as 64-bit little endian numbers.
+	void printBinary() const
+	{
+		writeLittleEndian(m_contracts);
+		writeLittleEndian(m_bytes);
+		for (size_t count: m_opcodeCounts)
+			writeLittleEndian(count);
+		std::cout.flush();
+	}
+
+private:
+	void process(bytes const& _code)
+	{
+		CodeStatistics const statistics = codeStatistics(bytesConstRef(&_code));
+		for (size_t opcode = 0; opcode < m_opcodeCounts.size(); ++opcode)
+			m_opcodeCounts[opcode] += statistics.opcodeCounts[opcode];
+		m_bytes += _code.size();
+
+		if (m_perContract)
+		{
+			Json::Value contract{Json::objectValue};
+			contract["index"] = Json::UInt64(m_contracts);
+			contract["size"] = Json::UInt64(_code.size());
+			contract["jumpdests"] = Json::arrayValue;
+			for (size_t jumpdest: statistics.jumpdests)
+				contract["jumpdests"].append(Json::UInt64(jumpdest));
+			contract["metadataOffset"] = statistics.metadataOffset ?
+				Json::Value(Json::UInt64(*statistics.metadataOffset)) :
+				Json::Value(Json::nullValue);
+			std::cout << jsonCompactPrint(contract) << "\n";
+		}
+		++m_contracts;
+	}
+
+	static std::string opcodeName(uint8_t _opcode)
+	{
+		if (isValidInstruction(Instruction(_opcode)))
+			return instructionInfo(Instruction(_opcode)).name;
+		return "0x" + toHex(_opcode);
+	}
+
+	static void writeLittleEndian(uint64_t _value)
+	{
+		std::array<char, 8> buffer;
+		for (char& byte: buffer)
+		{
+			byte = static_cast<char>(_value & 0xff);
+			_value >>= 8;
+		}
+		std::cout.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+	}
+
+	bool m_perContract = false;
+	uint64_t m_contracts = 0;
+	uint64_t m_bytes = 0;
+	std::array<uint64_t, 256> m_opcodeCounts{};
+};
+
+}
+
+int main(int argc, char** argv)
+{
+	try
+	{
+		bool perContract = false;
+		po::options_description options(
+			R"(bytecodestats, opcode statistics over deployed bytecode.
+	Usage: bytecodestats [Options] [<file>...]
+	Reads one hex encoded contract per line from each <file>, or from stdin
+	if no file or - is given, and prints a histogram of the opcodes used
+	outside of push data and metadata.
+
+	Allowed options)",
+			po::options_description::m_default_line_length,
+			po::options_description::m_default_line_length - 23);
+		options.add_options()
+			(
+				"input-file",
+				po::value<std::vector<std::string>>(),
+				"input file"
+			)
+			(
+				"output-format",
+				po::value<std::string>()->default_value("json"),
+				"format of the histogram: json, or binary for the number of contracts, the number "
+				"of bytes and the 256 opcode counts as 64-bit little endian numbers"
+			)
+			(
+				"per-contract",
+				po::bool_switch(&perContract)->default_value(false),
+				"before the histogram, print one JSON line per contract with its size, "
+				"jump destinations and metadata offset"
+			)
+			("help,h", "Show this help screen.");
+
+		// All positional options should be interpreted as input files
+		po::positional_options_description filesPositions;
+		filesPositions.add("input-file", -1);
+
+		po::variables_map arguments;
+		po::command_line_parser cmdLineParser(argc, argv);
+		cmdLineParser.options(options).positional(filesPositions);
+		po::store(cmdLineParser.run(), arguments);
+		po::notify(arguments);
+
+		if (arguments.count("help"))
+		{
+			std::cout << options;
+			return 0;
+		}
+
+		std::string const outputFormat = arguments["output-format"].as<std::string>();
+		if (outputFormat != "json" && outputFormat != "binary")
+		{
+			std::cerr << "Invalid output format: " << outputFormat << std::endl;
+			return 1;
+		}
+		if (outputFormat == "binary" && perContract)
+		{
+			std::cerr << "--per-contract requires --output-format json." << std::endl;
+			return 1;
+		}
+
+		std::vector<std::string> inputFiles{"-"};
+		if (arguments.count("input-file"))
+			inputFiles = arguments["input-file"].as<std::vector<std::string>>();
+
+		BytecodeStats stats{perContract};
+		for (std::string const& inputFile: inputFiles)
+		{
+			bool valid = true;
+			if (inputFile == "-")
+				valid = stats.processStream(std::cin, "<stdin>");
+			else
+			{
+				std::ifstream input(inputFile, std::ios::binary);
+				if (!input)
+				{
+					std::cerr << "Could not open file: " << inputFile << std::endl;
+					return 1;
+				}
+				valid = stats.processStream(input, inputFile);
+			}
+			if (!valid)
+				return 1;
+		}
+
+		if (outputFormat == "json")
+			stats.printJson();
+		else
+			stats.printBinary();
+		return 0;
+	}
+	catch (po::error const& _exception)
+	{
+		std::cerr << _exception.what() << std::endl;
+		return 1;
+	}
+	catch (...)
+	{
+		std::cerr << std::endl << "Exception:" << std::endl;
+		std::cerr << boost::current_exception_diagnostic_information() << std::endl;
+		return 1;
+	}
+}
@@ -177,11 +177,11 @@ public:
 		m_nameDispenser.reset(*m_ast);
 	}
 
-	void runSteps(string _source, string _steps)
+	void runSteps(string _source, string _steps, OptimiserSuite::Debug _debug, size_t _minRoundGain)
 	{
 		parse(_source);
 		disambiguate();
-		OptimiserSuite{m_context}.runSequence(_steps, *m_ast);
+		OptimiserSuite{m_context, _debug, _minRoundGain}.runSequence(_steps, *m_ast);
 		cout << AsmPrinter{m_dialect}(*m_ast) << endl;
 	}
 
@@ -261,6 +261,7 @@ int main(int argc, char** argv)
 	try
 	{
 		bool nonInteractive = false;
+		bool printSteps = false;
 		po::options_description options(
 			R"(yulopti, yul optimizer exploration tool.
 	Usage: yulopti [Options] <file>
@@ -288,6 +289,16 @@ int main(int argc, char** argv)
 				po::bool_switch(&nonInteractive)->default_value(false),
 				"stop after executing the provided steps"
 			)
+			(
+				"min-round-gain",
+				po::value<size_t>()->default_value(0),
+				"stop repeating a bracketed part of the steps once a round reduces the code size by less than the given percentage"
+			)
+			(
+				"print-steps",
+				po::bool_switch(&printSteps)->default_value(false),
+				"print the name of each step as it runs and the code size after each round of a bracketed part of the steps"
+			)
 			("help,h", "Show this help screen.");
 
 		// All positional options should be interpreted as input files
@@ -330,6 +341,13 @@ int main(int argc, char** argv)
 			return 1;
 		}
 
+		size_t const minRoundGain = arguments["min-round-gain"].as<size_t>();
+		if (minRoundGain > 100)
+		{
+			cerr << "--min-round-gain must be a percentage between 0 and 100." << endl;
+			return 1;
+		}
+
 		YulOpti yulOpti;
 		bool disambiguated = false;
 		if (!nonInteractive)
@@ -339,7 +357,12 @@ int main(int argc, char** argv)
 			string sequence = arguments["steps"].as<string>();
 			if (!nonInteractive)
 				cout << "----------------------" << endl;
-			yulOpti.runSteps(input, sequence);
+			yulOpti.runSteps(
+				input,
+				sequence,
+				printSteps ? OptimiserSuite::Debug::PrintStep : OptimiserSuite::Debug::None,
+				minRoundGain
+			);
 			disambiguated = true;
 		}
 		if (!nonInteractive)